@@ -0,0 +1,274 @@
+/**
+* @date 16.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "BatchSolver.hpp"
+#include "inout.hpp"
+#include "LocalSearch.hpp"
+#include "util/Profiler.hpp"
+
+namespace sat {
+    namespace {
+        /**
+         * @brief Single thread that enforces the deadlines of all instances of a batch run.
+         * @details @copybrief
+         * Instances register their deadline when they start and unregister it when they finish. Once the earliest
+         * deadline expires, the stop source of its instance is triggered
+         */
+        class DeadlineWatcher {
+            using Clock = std::chrono::steady_clock;
+
+            struct Entry {
+                Clock::time_point deadline;
+                std::stop_source source;
+                bool expired = false;
+            };
+
+            std::mutex mutex;
+            std::condition_variable_any wakeUp;
+            std::list<Entry> entries; ///< deadlines of the running instances, iterators stay valid on insertion
+            bool added = false; ///< whether a deadline was registered since the watcher last looked at the entries
+            std::jthread thread; ///< declared last => started after and stopped before the other members
+
+            void watch(std::stop_token done) {
+                std::unique_lock lock(mutex);
+                while (!done.stop_requested()) {
+                    added = false;
+                    auto next = Clock::time_point::max();
+                    for (auto &entry : entries) {
+                        if (entry.expired) {
+                            continue;
+                        }
+
+                        if (entry.deadline <= Clock::now()) {
+                            entry.expired = true;
+                            entry.source.request_stop();
+                        } else {
+                            next = std::min(next, entry.deadline);
+                        }
+                    }
+
+                    // woken up early whenever an instance is registered
+                    if (next == Clock::time_point::max()) {
+                        wakeUp.wait(lock, done, [this] { return added; });
+                    } else {
+                        wakeUp.wait_until(lock, done, next, [this] { return added; });
+                    }
+                }
+            }
+
+        public:
+            using Handle = std::list<Entry>::iterator;
+
+            DeadlineWatcher() : thread([this](std::stop_token done) { watch(std::move(done)); }) {}
+
+            /**
+             * Registers the deadline of an instance
+             * @param timeLimit time from now until the deadline. std::chrono::milliseconds::max() means no deadline
+             * @param source stop source that is triggered once the deadline expires
+             * @return handle through which the deadline is unregistered
+             */
+            Handle add(std::chrono::milliseconds timeLimit, std::stop_source source) {
+                Handle handle;
+                {
+                    std::lock_guard lock(mutex);
+                    const auto deadline = timeLimit == std::chrono::milliseconds::max() ?
+                                          Clock::time_point::max() : Clock::now() + timeLimit;
+                    handle = entries.emplace(entries.end(), deadline, std::move(source));
+                    added = true;
+                }
+
+                wakeUp.notify_one();
+                return handle;
+            }
+
+            /**
+             * Unregisters the deadline of an instance
+             * @param handle handle returned by add
+             * @return whether the deadline expired before it was unregistered
+             */
+            bool remove(Handle handle) {
+                std::lock_guard lock(mutex);
+                const bool expired = handle->expired;
+                entries.erase(handle);
+                return expired;
+            }
+        };
+
+        /**
+         * Parses, preprocesses and solves a single instance under the limits of the options
+         * @param file path of the instance
+         * @param options batch options
+         * @param deadlines watcher that enforces the time limit
+         * @param stop stop token of the batch
+         * @return result of the instance
+         */
+        InstanceResult solveInstance(const std::string &file, const BatchOptions &options, DeadlineWatcher &deadlines,
+                                     std::stop_token stop) {
+            InstanceResult result{.file = file};
+            StopWatch watch;
+            std::stop_source source;
+            std::stop_callback forward(stop, [&source] { source.request_stop(); });
+            const auto deadline = deadlines.add(options.timeLimit, source);
+            SolveResult answer = SolveResult::Unknown;
+            bool memoryExceeded = false;
+            try {
+                std::ifstream ifs(file);
+                if (!ifs.is_open()) {
+                    throw std::runtime_error("could not open " + file);
+                }
+
+                auto [clauses, numVariables] = inout::read_from_dimacs(ifs);
+                if (options.preprocessing) {
+                    Preprocessor preprocessor(static_cast<unsigned>(numVariables), options.blockingStepLimit);
+                    preprocessor.setStopToken(source.get_token());
+                    for (auto &clause : clauses) {
+                        if (!preprocessor.addClause(std::move(clause))) {
+                            break;
+                        }
+                    }
+
+                    preprocessor.eliminate();
+                    clauses = preprocessor.getClauses();
+                }
+
+                auto config = options.config;
+                config.memoryLimit = options.memoryLimit;
+                Solver solver(static_cast<unsigned>(numVariables));
+                configure(solver, static_cast<unsigned>(numVariables), config);
+                solver.setStopToken(source.get_token());
+                bool consistent = true;
+                for (const auto &clause : clauses) {
+                    if (!solver.addClause(Clause(clause))) {
+                        consistent = false;
+                        break;
+                    }
+                }
+
+                if (consistent && config.localSearchFlips > 0) {
+                    initializePhases(solver, clauses, static_cast<unsigned>(numVariables), config.localSearchFlips,
+                                     source.get_token());
+                }
+
+                answer = solver.solve();
+                memoryExceeded = answer == SolveResult::Unknown && solver.memoryUsage() > config.memoryLimit;
+            } catch (const std::exception &) {
+                // also covers std::bad_alloc
+                deadlines.remove(deadline);
+                result.status = InstanceStatus::Error;
+                result.time = std::chrono::milliseconds(watch.elapsed<std::chrono::milliseconds>());
+                return result;
+            }
+
+            const bool timedOut = deadlines.remove(deadline);
+            if (answer == SolveResult::Sat) {
+                result.status = InstanceStatus::Sat;
+            } else if (answer == SolveResult::Unsat) {
+                result.status = InstanceStatus::Unsat;
+            } else if (memoryExceeded) {
+                result.status = InstanceStatus::Memout;
+            } else if (timedOut) {
+                result.status = InstanceStatus::Timeout;
+            } else if (stop.stop_requested()) {
+                result.status = InstanceStatus::Cancelled;
+            } else {
+                result.status = InstanceStatus::Error;
+            }
+
+            result.time = std::chrono::milliseconds(watch.elapsed<std::chrono::milliseconds>());
+            return result;
+        }
+    }
+
+    std::vector<std::string> collectInstances(const std::string &path) {
+        namespace fs = std::filesystem;
+        std::vector<std::string> files;
+        if (fs::is_directory(path)) {
+            for (const auto &entry : fs::recursive_directory_iterator(path)) {
+                if (entry.is_regular_file() && entry.path().extension() == ".cnf") {
+                    files.emplace_back(entry.path().string());
+                }
+            }
+
+            std::ranges::sort(files);
+            return files;
+        }
+
+        if (!fs::is_regular_file(path)) {
+            throw std::runtime_error(path + " does not exist");
+        }
+
+        if (fs::path(path).extension() == ".cnf") {
+            files.emplace_back(path);
+            return files;
+        }
+
+        std::ifstream list(path);
+        std::string line;
+        while (std::getline(list, line)) {
+            if (!line.empty()) {
+                files.emplace_back(std::move(line));
+            }
+        }
+
+        return files;
+    }
+
+    unsigned maxInFlight(const BatchOptions &options) {
+        std::size_t inFlight = options.numThreads;
+        // without a limit per instance, the budget says nothing about the memory of an instance
+        if (options.memoryBudget != std::numeric_limits<std::size_t>::max() &&
+            options.memoryLimit != std::numeric_limits<std::size_t>::max()) {
+            inFlight = std::min(inFlight, options.memoryBudget / std::max<std::size_t>(options.memoryLimit, 1));
+        }
+
+        return static_cast<unsigned>(std::max<std::size_t>(inFlight, 1));
+    }
+
+    std::vector<InstanceResult> solveBatch(const std::vector<std::string> &files, const BatchOptions &options,
+                                           const std::function<void(const InstanceResult &)> &onResult,
+                                           std::stop_token stop) {
+        std::vector<InstanceResult> results(files.size());
+        for (std::size_t i = 0; i < files.size(); ++i) {
+            results[i].file = files[i];
+        }
+
+        std::atomic<std::size_t> next = 0;
+        std::mutex reportMutex;
+        DeadlineWatcher deadlines;
+        {
+            const auto numWorkers = maxInFlight(options);
+            std::vector<std::jthread> workers;
+            workers.reserve(numWorkers);
+            for (unsigned w = 0; w < numWorkers; ++w) {
+                workers.emplace_back([&] {
+                    while (!stop.stop_requested()) {
+                        const auto index = next++;
+                        if (index >= files.size()) {
+                            return;
+                        }
+
+                        results[index] = solveInstance(files[index], options, deadlines, stop);
+                        if (onResult) {
+                            std::lock_guard lock(reportMutex);
+                            onResult(results[index]);
+                        }
+                    }
+                });
+            }
+        } // workers are joined here
+
+        return results;
+    }
+}
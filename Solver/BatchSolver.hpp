@@ -0,0 +1,84 @@
+/**
+* @date 16.10.26
+* @file BatchSolver.hpp
+* @brief Contains the batch mode that solves many instances on a thread pool
+*/
+
+#ifndef BATCHSOLVER_HPP
+#define BATCHSOLVER_HPP
+
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <functional>
+#include <stop_token>
+
+#include "Portfolio.hpp"
+#include "Preprocessor.hpp"
+#include "util/enum.hpp"
+
+namespace sat {
+    PENUM(InstanceStatus, Sat, Unsat, Timeout, Memout, Cancelled, Error)
+
+    /**
+     * @brief Limits and solver settings of a batch run
+     */
+    struct BatchOptions {
+        unsigned numThreads = 1; ///< number of threads of the pool. Each thread solves one instance at a time
+        /// time limit per instance. The limit is enforced during preprocessing and search, parsing is not interrupted
+        std::chrono::milliseconds timeLimit = std::chrono::milliseconds::max();
+        /// memory limit per instance in bytes (see Solver::setMemoryLimit)
+        std::size_t memoryLimit = std::numeric_limits<std::size_t>::max();
+        /// total memory in bytes. At most memoryBudget / memoryLimit instances are in flight, regardless of numThreads.
+        /// Ignored if memoryLimit is not set
+        std::size_t memoryBudget = std::numeric_limits<std::size_t>::max();
+        bool preprocessing = true;
+        std::size_t blockingStepLimit = Preprocessor::DefaultBlockingStepLimit; ///< see Preprocessor
+        SolverConfig config; ///< configuration of the solvers, the memory limit is set from memoryLimit
+    };
+
+    /**
+     * @brief Outcome of a single instance of a batch run
+     */
+    struct InstanceResult {
+        std::string file;
+        InstanceStatus status = InstanceStatus::Cancelled;
+        std::chrono::milliseconds time{0}; ///< wall clock time from parsing to the answer
+    };
+
+    /**
+     * Collects the instances of a batch run
+     * @param path either a directory that is searched recursively for .cnf files, a single .cnf file or a text file
+     * that lists one instance per line
+     * @return paths of the instances. The files of a directory are sorted by path
+     * @throws std::runtime_error if the path does not exist
+     */
+    std::vector<std::string> collectInstances(const std::string &path);
+
+    /**
+     * Computes the number of instances that are solved at the same time
+     * @param options batch options
+     * @return minimum of the number of threads and memoryBudget / memoryLimit (if both are set), at least 1
+     */
+    unsigned maxInFlight(const BatchOptions &options);
+
+    /**
+     * Solves the given instances on a pool of maxInFlight(options) threads. Instances are handed out in the given
+     * order. Each instance is parsed, preprocessed and solved by a single solver under the time and memory limit. A
+     * single watcher thread enforces the time limits of all instances. Preprocessor and solver are stopped through
+     * their stop token once the time limit of their instance expires
+     * @param files paths of the instances
+     * @param options limits and solver settings
+     * @param onResult called with the result of every instance as soon as it finishes. Calls are serialized
+     * @param stop stop token through which the whole batch can be cancelled. Instances that were not started yet are
+     * not passed to onResult and keep the status InstanceStatus::Cancelled
+     * @return results in the order of files
+     */
+    std::vector<InstanceResult> solveBatch(const std::vector<std::string> &files, const BatchOptions &options,
+                                           const std::function<void(const InstanceResult &)> &onResult = {},
+                                           std::stop_token stop = {});
+}
+
+#endif //BATCHSOLVER_HPP
@@ -80,11 +80,8 @@ namespace sat {
     }
 
     bool Clause::sameLiterals(const Clause &other) const {
-        if (clause.size()!=other.clause.size()) return false;
-        auto copy1 =clause;
-        auto copy2 = other.clause;
-        return copy1 ==copy2;
-        
+        // literals are sorted by the ctor => no copies needed
+        return clause == other.clause;
     }
 
 }
@@ -0,0 +1,48 @@
+/**
+* @date 16.10.26
+* @brief
+*/
+
+#include "ClauseArena.hpp"
+
+namespace sat {
+    void ClauseArena::free(ClauseRef ref) noexcept {
+        memory[ref + 1] |= ClauseView::DeletedFlag;
+        wastedWords += ClauseView::HeaderSize + memory[ref];
+    }
+
+    void ClauseArena::shrink(ClauseRef ref, std::uint32_t newSize) noexcept {
+        wastedWords += memory[ref] - newSize;
+        memory[ref] = newSize;
+        (*this)[ref].updateSignature();
+    }
+
+    ClauseRef ClauseArena::relocate(ClauseRef ref, ClauseArena &to) {
+        if (memory[ref + 1] & ClauseView::RelocatedFlag) {
+            return memory[ref];
+        }
+
+        const auto size = memory[ref];
+        const auto newRef = static_cast<ClauseRef>(to.memory.size());
+        if (to.memory.size() + ClauseView::HeaderSize + size > NoClause) {
+            throw std::length_error("clause arena exceeds the range of 32-bit clause references");
+        }
+
+        to.memory.insert(to.memory.end(), memory.begin() + ref, memory.begin() + ref + ClauseView::HeaderSize + size);
+        memory[ref + 1] |= ClauseView::RelocatedFlag;
+        memory[ref] = newRef;
+        return newRef;
+    }
+
+    void ClauseArena::reserve(std::size_t numWords) {
+        memory.reserve(numWords);
+    }
+
+    std::size_t ClauseArena::size() const noexcept {
+        return memory.size();
+    }
+
+    std::size_t ClauseArena::wasted() const noexcept {
+        return wastedWords;
+    }
+}
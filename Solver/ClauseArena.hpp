@@ -0,0 +1,333 @@
+/**
+* @date 16.10.26
+* @file ClauseArena.hpp
+* @brief Contains the flat clause storage used by the solver
+*/
+
+#ifndef CLAUSEARENA_HPP
+#define CLAUSEARENA_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <algorithm>
+#include <stdexcept>
+
+#include "basic_structures.hpp"
+
+namespace sat {
+    /**
+     * Reference to a clause in a ClauseArena. It is the offset of the clause header in the arena
+     */
+    using ClauseRef = std::uint32_t;
+
+    /// Invalid clause reference
+    inline constexpr ClauseRef NoClause = std::numeric_limits<ClauseRef>::max();
+
+    /**
+     * @brief Retention tier of a learned clause
+     */
+    enum class ClauseTier : std::uint32_t {
+        Core = 0, ///< very low LBD, kept forever
+        Mid = 1, ///< low LBD, kept as long as the clause is used between two reductions
+        Local = 2 ///< high LBD, about half of these are deleted at each reduction
+    };
+
+    /**
+     * Signature bit of a literal. The bit only depends on the variable, so that signatures can be used to filter
+     * candidates for subsumption as well as for self-subsuming resolution
+     * @param l the literal
+     * @return 64-bit mask with a single bit set
+     */
+    constexpr std::uint64_t signatureBit(Literal l) noexcept {
+        return std::uint64_t(1) << (var(l).get() % 64);
+    }
+
+    namespace detail {
+        /**
+         * @brief Iterator over the literals of a clause stored in a ClauseArena. Models std::forward_iterator
+         */
+        class ArenaLiteralIterator {
+            const std::uint32_t *ptr = nullptr;
+        public:
+            using value_type = Literal;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::forward_iterator_tag;
+
+            ArenaLiteralIterator() = default;
+
+            explicit ArenaLiteralIterator(const std::uint32_t *ptr) noexcept: ptr(ptr) {}
+
+            Literal operator*() const {
+                return Literal(*ptr);
+            }
+
+            ArenaLiteralIterator &operator++() noexcept {
+                ++ptr;
+                return *this;
+            }
+
+            ArenaLiteralIterator operator++(int) noexcept {
+                auto tmp = *this;
+                ++ptr;
+                return tmp;
+            }
+
+            bool operator==(const ArenaLiteralIterator &other) const noexcept = default;
+        };
+
+        /**
+         * @brief View of a clause stored in a ClauseArena.
+         * @details @copybrief
+         * The view is a pointer to the clause header. Literals are stored inline after the header. The view is
+         * invalidated when the arena grows or is compacted.
+         * @tparam Word either std::uint32_t or const std::uint32_t
+         */
+        template<typename Word>
+        class BasicClauseView {
+            Word *data;
+        public:
+            /*
+             * Header layout:
+             * word 0: number of literals (forwarding reference after relocation)
+             * word 1: bit 0 learned, bit 1 deleted, bit 2 used, bit 3 relocated, bits 4-5 tier, bit 6 imported,
+             * bits 8-31 LBD
+             * word 2-3: 64-bit signature, the bitwise or of the signature bits of all literals
+             */
+            /// Number of 32-bit words before the first literal
+            static constexpr std::size_t HeaderSize = 4;
+            static constexpr std::uint32_t LearnedFlag = 1u;
+            static constexpr std::uint32_t DeletedFlag = 1u << 1;
+            static constexpr std::uint32_t UsedFlag = 1u << 2;
+            static constexpr std::uint32_t RelocatedFlag = 1u << 3;
+            static constexpr std::uint32_t TierShift = 4;
+            static constexpr std::uint32_t TierMask = 3u << TierShift;
+            static constexpr std::uint32_t ImportedFlag = 1u << 6;
+            static constexpr std::uint32_t LbdShift = 8;
+            static constexpr std::uint32_t MaxLbd = (1u << (32 - LbdShift)) - 1;
+
+            explicit BasicClauseView(Word *data) noexcept: data(data) {}
+
+            /**
+             * Number of literals in the clause
+             */
+            std::uint32_t size() const noexcept {
+                return data[0];
+            }
+
+            /**
+             * Whether the clause was learned during search
+             */
+            bool learned() const noexcept {
+                return data[1] & LearnedFlag;
+            }
+
+            /**
+             * Whether the clause has been deleted. Deleted clauses remain in the arena until it is compacted
+             */
+            bool deleted() const noexcept {
+                return data[1] & DeletedFlag;
+            }
+
+            /**
+             * Whether the clause took part in conflict analysis since the flag was last reset
+             */
+            bool used() const noexcept {
+                return data[1] & UsedFlag;
+            }
+
+            void setUsed(bool used) noexcept requires (not std::is_const_v<Word>) {
+                data[1] = used ? data[1] | UsedFlag : data[1] & ~UsedFlag;
+            }
+
+            /**
+             * Whether the clause was learned by another solver and has not taken part in conflict analysis yet
+             */
+            bool imported() const noexcept {
+                return data[1] & ImportedFlag;
+            }
+
+            void setImported(bool imported) noexcept requires (not std::is_const_v<Word>) {
+                data[1] = imported ? data[1] | ImportedFlag : data[1] & ~ImportedFlag;
+            }
+
+            /**
+             * Literal block distance, i.e. the number of distinct decision levels in the clause when it was learned
+             * or last used
+             */
+            std::uint32_t lbd() const noexcept {
+                return data[1] >> LbdShift;
+            }
+
+            void setLbd(std::uint32_t lbd) noexcept requires (not std::is_const_v<Word>) {
+                data[1] = (data[1] & ((1u << LbdShift) - 1)) | (std::min(lbd, MaxLbd) << LbdShift);
+            }
+
+            ClauseTier tier() const noexcept {
+                return static_cast<ClauseTier>((data[1] & TierMask) >> TierShift);
+            }
+
+            void setTier(ClauseTier tier) noexcept requires (not std::is_const_v<Word>) {
+                data[1] = (data[1] & ~TierMask) | (static_cast<std::uint32_t>(tier) << TierShift);
+            }
+
+            /**
+             * Signature of the clause. If the signature of a clause A has a bit that is not set in the signature of
+             * clause B, then A can neither subsume B nor strengthen B by self-subsuming resolution
+             */
+            std::uint64_t signature() const noexcept {
+                return std::uint64_t(data[2]) | (std::uint64_t(data[3]) << 32);
+            }
+
+            /**
+             * Recomputes the signature from the literals. Needs to be called after literals are replaced
+             */
+            void updateSignature() noexcept requires (not std::is_const_v<Word>) {
+                std::uint64_t signature = 0;
+                for (Literal l : *this) {
+                    signature |= signatureBit(l);
+                }
+
+                data[2] = static_cast<std::uint32_t>(signature);
+                data[3] = static_cast<std::uint32_t>(signature >> 32);
+            }
+
+            /**
+             * Literal at the given position. Positions 0 and 1 hold the watch literals
+             */
+            Literal operator[](std::size_t index) const {
+                return Literal(data[HeaderSize + index]);
+            }
+
+            /**
+             * Replaces the literal at the given position
+             */
+            void set(std::size_t index, Literal l) noexcept requires (not std::is_const_v<Word>) {
+                data[HeaderSize + index] = l.get();
+            }
+
+            /**
+             * Swaps the literals at the given positions
+             */
+            void swap(std::size_t i, std::size_t j) noexcept requires (not std::is_const_v<Word>) {
+                std::swap(data[HeaderSize + i], data[HeaderSize + j]);
+            }
+
+            auto begin() const noexcept {
+                return ArenaLiteralIterator(data + HeaderSize);
+            }
+
+            auto end() const noexcept {
+                return ArenaLiteralIterator(data + HeaderSize + size());
+            }
+        };
+    }
+
+    using ClauseView = detail::BasicClauseView<std::uint32_t>;
+    using ConstClauseView = detail::BasicClauseView<const std::uint32_t>;
+
+    /**
+     * @brief Contiguous storage of clauses in a single buffer of 32-bit words.
+     * @details @copybrief
+     * Each clause consists of a four word header (size, flags and a 64-bit signature for subsumption checks) that is
+     * directly followed by its literals. Clauses are identified by their 32-bit offset (ClauseRef) which is stable as
+     * long as the arena is not compacted. Compared to
+     * separately allocated clauses, visiting a clause costs a single memory access to a location close to other
+     * clauses.
+     */
+    class ClauseArena {
+        std::vector<std::uint32_t> memory;
+        std::size_t wastedWords = 0;
+    public:
+        /**
+         * Stores a new clause
+         * @tparam Literals range of literals
+         * @param literals literals of the clause. The order is preserved
+         * @param learned whether the clause was learned during search
+         * @return reference to the new clause
+         * @throws std::length_error if the arena would outgrow the range of ClauseRef
+         */
+        template<typename Literals>
+        ClauseRef alloc(const Literals &literals, bool learned) {
+            const auto ref = static_cast<ClauseRef>(memory.size());
+            memory.emplace_back(0);
+            memory.emplace_back(learned ? ClauseView::LearnedFlag : 0u);
+            memory.emplace_back(0);
+            memory.emplace_back(0);
+            std::uint32_t size = 0;
+            for (Literal l : literals) {
+                memory.emplace_back(l.get());
+                ++size;
+            }
+
+            if (memory.size() > NoClause) {
+                memory.resize(ref);
+                throw std::length_error("clause arena exceeds the range of 32-bit clause references");
+            }
+
+            memory[ref] = size;
+            (*this)[ref].updateSignature();
+            return ref;
+        }
+
+        /**
+         * Access to a clause
+         * @param ref reference to the clause (must be valid)
+         * @return view of the clause
+         */
+        ClauseView operator[](ClauseRef ref) noexcept {
+            return ClauseView(memory.data() + ref);
+        }
+
+        /**
+         * @copydoc operator[]
+         */
+        ConstClauseView operator[](ClauseRef ref) const noexcept {
+            return ConstClauseView(memory.data() + ref);
+        }
+
+        /**
+         * Marks a clause as deleted. Its memory is reclaimed by the next compaction
+         * @param ref clause to delete (must not be deleted already)
+         */
+        void free(ClauseRef ref) noexcept;
+
+        /**
+         * Removes the last literals of a clause. Their memory is reclaimed by the next compaction
+         * @param ref the clause
+         * @param newSize new number of literals (at most the current size)
+         */
+        void shrink(ClauseRef ref, std::uint32_t newSize) noexcept;
+
+        /**
+         * Copies a clause into another arena unless this has already happened. The old location then holds a
+         * forwarding reference, so that all references to a clause can be relocated one by one.
+         * @param ref clause to relocate (must not be deleted)
+         * @param to destination arena
+         * @return reference of the clause in the destination arena
+         * @throws std::length_error if the destination arena would outgrow the range of ClauseRef
+         */
+        ClauseRef relocate(ClauseRef ref, ClauseArena &to);
+
+        /**
+         * Reserves memory for the given number of words
+         * @param numWords number of 32-bit words
+         */
+        void reserve(std::size_t numWords);
+
+        /**
+         * Number of words in use
+         */
+        std::size_t size() const noexcept;
+
+        /**
+         * Number of words occupied by deleted clauses
+         */
+        std::size_t wasted() const noexcept;
+    };
+}
+
+#endif //CLAUSEARENA_HPP
@@ -0,0 +1,132 @@
+/**
+* @date 16.10.26
+* @brief
+*/
+
+#include <algorithm>
+
+#include "ClauseExchange.hpp"
+
+namespace sat {
+    ClauseRing::ClauseRing(std::size_t capacity) : slots(std::make_unique<Slot[]>(capacity)), capacity(capacity) {}
+
+    void ClauseRing::push(std::span<const Literal> literals, unsigned lbd) {
+        const auto index = head.load(std::memory_order_relaxed);
+        auto &slot = slots[index % capacity];
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        // release stores => a consumer that reads any of the new contents also sees the odd sequence number
+        slot.size.store(static_cast<std::uint32_t>(literals.size()), std::memory_order_release);
+        slot.lbd.store(lbd, std::memory_order_release);
+        for (std::size_t i = 0; i < literals.size(); ++i) {
+            slot.literals[i].store(literals[i].get(), std::memory_order_release);
+        }
+
+        slot.sequence.store(2 * index + 2, std::memory_order_release);
+        head.store(index + 1, std::memory_order_release);
+    }
+
+    bool ClauseRing::pop(std::uint64_t &position, std::vector<Literal> &literals, unsigned &lbd) const {
+        while (true) {
+            const auto available = head.load(std::memory_order_acquire);
+            if (position >= available) {
+                return false;
+            }
+
+            // clauses older than the capacity have been overwritten
+            position = std::max(position, available > capacity ? available - capacity : 0);
+            const auto index = position++;
+            const auto &slot = slots[index % capacity];
+            const auto sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence != 2 * index + 2) {
+                continue;
+            }
+
+            // acquire loads => the sequence number cannot be read again before the contents
+            const auto size = std::min<std::size_t>(slot.size.load(std::memory_order_acquire), SlotSize);
+            lbd = slot.lbd.load(std::memory_order_acquire);
+            literals.clear();
+            for (std::size_t i = 0; i < size; ++i) {
+                literals.emplace_back(slot.literals[i].load(std::memory_order_acquire));
+            }
+
+            // the contents are only valid if the producer did not start to overwrite the slot in the meantime
+            if (slot.sequence.load(std::memory_order_relaxed) == sequence) {
+                return true;
+            }
+        }
+    }
+
+    ClauseExchange::ClauseExchange(std::size_t numWorkers, std::size_t maxSize, unsigned maxLbd,
+                                   std::size_t capacity)
+        : maxSize(std::min(maxSize, ClauseRing::SlotSize)), maxLbd(maxLbd) {
+        rings.reserve(numWorkers);
+        for (std::size_t i = 0; i < numWorkers; ++i) {
+            rings.emplace_back(std::make_unique<ClauseRing>(capacity));
+        }
+    }
+
+    ClauseSharing ClauseExchange::connect(std::size_t worker) {
+        // state of the worker, only accessed by the worker's thread
+        struct Port {
+            std::vector<std::uint64_t> positions; ///< per ring: read position
+            std::size_t nextRing = 0; ///< ring to read from next, the rings are visited round robin
+            /// direct mapped table of hashes of exported and imported clauses => bounded memory
+            std::vector<std::uint64_t> known = std::vector<std::uint64_t>(KnownCapacity, 0);
+
+            /// returns false if the hash is known, otherwise remembers it
+            bool remember(std::uint64_t hash) {
+                auto &slot = known[hash % KnownCapacity];
+                if (slot == hash) {
+                    return false;
+                }
+
+                slot = hash;
+                return true;
+            }
+        };
+
+        auto port = std::make_shared<Port>();
+        port->positions.resize(rings.size(), 0);
+        ClauseSharing sharing;
+        sharing.exportClause = [this, worker, port](std::span<const Literal> literals, unsigned lbd) {
+            if (literals.size() > maxSize || lbd > maxLbd || !port->remember(hash(literals))) {
+                return false;
+            }
+
+            rings[worker]->push(literals, lbd);
+            return true;
+        };
+
+        sharing.importClause = [this, worker, port](std::vector<Literal> &literals, unsigned &lbd) {
+            for (std::size_t visited = 0; visited < rings.size();) {
+                const auto ring = port->nextRing;
+                if (ring == worker || !rings[ring]->pop(port->positions[ring], literals, lbd)) {
+                    port->nextRing = (ring + 1) % rings.size();
+                    ++visited;
+                    continue;
+                }
+
+                if (port->remember(hash(literals))) {
+                    return true;
+                }
+            }
+
+            return false;
+        };
+
+        return sharing;
+    }
+
+    std::uint64_t ClauseExchange::hash(std::span<const Literal> literals) noexcept {
+        // sum of mixed literals (splitmix64 finalizer) => independent of the literal order
+        std::uint64_t result = literals.size();
+        for (Literal l : literals) {
+            std::uint64_t x = l.get() + 0x9e3779b97f4a7c15ull;
+            x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+            x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+            result += x ^ (x >> 31);
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,119 @@
+/**
+* @date 16.10.26
+* @file ClauseExchange.hpp
+* @brief Contains lock-free buffers through which parallel solvers share learned clauses
+*/
+
+#ifndef CLAUSEEXCHANGE_HPP
+#define CLAUSEEXCHANGE_HPP
+
+#include <vector>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <span>
+
+#include "basic_structures.hpp"
+#include "Solver.hpp"
+
+namespace sat {
+    /**
+     * @brief Single-producer multi-consumer ring buffer of short clauses.
+     * @details @copybrief
+     * Every consumer reads every clause, using its own read position. The producer never waits: if a consumer falls
+     * behind by more than the capacity, the oldest clauses are overwritten and the consumer skips them. Each slot is
+     * protected by a sequence number (seqlock), so that consumers detect and drop clauses that were overwritten while
+     * they were being read.
+     */
+    class ClauseRing {
+    public:
+        /// maximum number of literals of a clause in the ring
+        static constexpr std::size_t SlotSize = 16;
+
+    private:
+        struct Slot {
+            /// 2 * (index + 1) once the clause with the given index is complete, odd while it is being written
+            std::atomic<std::uint64_t> sequence{0};
+            std::atomic<std::uint32_t> size{0};
+            std::atomic<std::uint32_t> lbd{0};
+            std::array<std::atomic<std::uint32_t>, SlotSize> literals{};
+        };
+
+        std::unique_ptr<Slot[]> slots;
+        std::size_t capacity;
+        std::atomic<std::uint64_t> head{0}; ///< number of clauses published so far
+
+    public:
+        /**
+         * Ctor
+         * @param capacity number of slots
+         */
+        explicit ClauseRing(std::size_t capacity);
+
+        /**
+         * Publishes a clause. Must only be called by the producer thread
+         * @param literals literals of the clause (at most SlotSize)
+         * @param lbd literal block distance of the clause
+         */
+        void push(std::span<const Literal> literals, unsigned lbd);
+
+        /**
+         * Reads the clause at the given read position. Can be called by any thread
+         * @param position read position of the consumer, advanced past the clause that was read or skipped
+         * @param literals output: literals of the clause
+         * @param lbd output: literal block distance of the clause
+         * @return true if a clause was read, false if there is no new clause
+         */
+        bool pop(std::uint64_t &position, std::vector<Literal> &literals, unsigned &lbd) const;
+    };
+
+    /**
+     * @brief Exchanges learned clauses between the solvers of a portfolio.
+     * @details @copybrief
+     * Each worker exports to its own ClauseRing and imports from the rings of all other workers. Only clauses with few
+     * literals and a low LBD are exported. Each worker remembers the hashes of the clauses it has exported or imported
+     * in a fixed size table, so that recent duplicates are neither exported nor imported again. Nothing is locked:
+     * exports happen when a clause is learned and imports happen when the solver is on level 0.
+     */
+    class ClauseExchange {
+        std::vector<std::unique_ptr<ClauseRing>> rings;
+        std::size_t maxSize;
+        unsigned maxLbd;
+
+    public:
+        static constexpr std::size_t DefaultCapacity = 4096;
+        static constexpr std::size_t DefaultMaxSize = 8;
+        static constexpr unsigned DefaultMaxLbd = 4;
+        /// number of clause hashes remembered per worker. A new hash replaces the one in its slot
+        static constexpr std::size_t KnownCapacity = 1 << 16;
+
+        /**
+         * Ctor
+         * @param numWorkers number of workers
+         * @param maxSize longer clauses are not exported (at most ClauseRing::SlotSize)
+         * @param maxLbd clauses with a higher LBD are not exported
+         * @param capacity number of clauses per ring
+         */
+        explicit ClauseExchange(std::size_t numWorkers, std::size_t maxSize = DefaultMaxSize,
+                                unsigned maxLbd = DefaultMaxLbd, std::size_t capacity = DefaultCapacity);
+
+        /**
+         * Creates the clause sharing hooks of a worker. The hooks must only be used by the worker's thread and must
+         * not outlive the exchange
+         * @param worker index of the worker
+         * @return hooks to pass to Solver::setClauseSharing
+         */
+        ClauseSharing connect(std::size_t worker);
+
+        /**
+         * Order independent hash of a clause
+         * @param literals literals of the clause
+         * @return hash value
+         */
+        static std::uint64_t hash(std::span<const Literal> literals) noexcept;
+    };
+}
+
+#endif //CLAUSEEXCHANGE_HPP
@@ -0,0 +1,229 @@
+/**
+* @date 16.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "CubeAndConquer.hpp"
+#include "util/WorkStealingQueue.hpp"
+
+namespace sat {
+    CubeGenerator::CubeGenerator(const std::vector<std::vector<Literal>> &clauses, unsigned numVariables)
+        : solver(numVariables), numVariables(numVariables), occurrences(numVariables, 0) {
+        for (const auto &clause : clauses) {
+            for (Literal l : clause) {
+                ++occurrences[var(l).get()];
+            }
+
+            if (!unsat && !solver.addClause(Clause(clause))) {
+                unsat = true;
+            }
+        }
+    }
+
+    std::size_t CubeGenerator::lookahead(Literal l) {
+        solver.newDecisionLevel();
+        return solver.assign(l) && solver.unitPropagate() ? solver.numAssignments() : 0;
+    }
+
+    void CubeGenerator::split(unsigned depth) {
+        const unsigned level = solver.currentLevel();
+        const auto cubeSize = cube.size();
+        std::vector<unsigned> candidates;
+        for (unsigned varId = 0; varId < numVariables && depth > 0; ++varId) {
+            // variables without occurrences (e.g. eliminated by preprocessing) would split nothing but double the cubes
+            if (solver.val(varId) == TruthValue::Undefined && occurrences[varId] > 0) {
+                candidates.emplace_back(varId);
+            }
+        }
+
+        const auto numCandidates = std::min(candidates.size(), MaxCandidates);
+        std::ranges::partial_sort(candidates, candidates.begin() + static_cast<std::ptrdiff_t>(numCandidates),
+                                  std::ranges::greater{}, [this](unsigned varId) { return occurrences[varId]; });
+        candidates.resize(numCandidates);
+        std::size_t bestScore = 0;
+        Literal best = 0;
+        // implied literals change the assignment the scores were computed on => repeat until none is found, so that the
+        // best variable is still unassigned afterwards
+        for (bool foundImplied = true; foundImplied;) {
+            foundImplied = false;
+            bestScore = 0;
+            for (unsigned varId : candidates) {
+                if (solver.val(varId) != TruthValue::Undefined) {
+                    continue;
+                }
+
+                const unsigned nodeLevel = solver.currentLevel();
+                const std::size_t base = solver.numAssignments();
+                const auto posCount = lookahead(pos(varId));
+                solver.backtrack(nodeLevel);
+                const auto negCount = lookahead(neg(varId));
+                solver.backtrack(nodeLevel);
+                if (posCount == 0 && negCount == 0) {
+                    // both polarities fail => no model extends the cube
+                    solver.backtrack(level);
+                    cube.resize(cubeSize, 0);
+                    return;
+                }
+
+                if (posCount == 0 || negCount == 0) {
+                    // the polarity that does not fail is implied, its decision level stays open until the node is left
+                    const Literal implied = posCount == 0 ? neg(varId) : pos(varId);
+                    lookahead(implied);
+                    cube.emplace_back(implied);
+                    foundImplied = true;
+                    continue;
+                }
+
+                const auto score = (posCount - base) * (negCount - base);
+                if (score > bestScore) {
+                    bestScore = score;
+                    best = pos(varId);
+                }
+            }
+        }
+
+        if (bestScore == 0) {
+            cubes.emplace_back(cube);
+        } else {
+            const unsigned nodeLevel = solver.currentLevel();
+            for (Literal l : {best, best.negate()}) {
+                if (lookahead(l) != 0) {
+                    cube.emplace_back(l);
+                    split(depth - 1);
+                    cube.pop_back();
+                }
+
+                solver.backtrack(nodeLevel);
+            }
+        }
+
+        solver.backtrack(level);
+        cube.resize(cubeSize, 0);
+    }
+
+    std::vector<std::vector<Literal>> CubeGenerator::generate(unsigned depth) {
+        cubes.clear();
+        if (!unsat && solver.unitPropagate()) {
+            split(depth);
+        }
+
+        return std::move(cubes);
+    }
+
+    CubeResult solveCubes(const std::vector<std::vector<Literal>> &clauses, unsigned numVariables,
+                          const std::vector<SolverConfig> &configs, unsigned depth, std::stop_token stop) {
+        CubeResult outcome;
+        auto cubes = CubeGenerator(clauses, numVariables).generate(depth);
+        outcome.cubes = cubes.size();
+        for (auto &cube : cubes) {
+            std::ranges::sort(cube, {}, [](Literal l) { return l.get(); });
+        }
+
+        // cubes are dealt round robin, idle workers steal from the others
+        const auto numWorkers = configs.size();
+        std::vector<WorkStealingQueue<std::size_t>> queues(numWorkers);
+        for (std::size_t i = 0; i < cubes.size(); ++i) {
+            queues[i % numWorkers].push(i);
+        }
+
+        std::mutex coresMutex;
+        std::vector<std::vector<Literal>> cores; ///< failed assumptions of refuted cubes, sorted
+        std::atomic<std::size_t> solvedCubes = 0;
+        std::atomic<std::size_t> prunedCubes = 0;
+        std::atomic_bool unresolved = false; ///< whether a cube was neither refuted nor satisfied
+        std::stop_source source;
+        std::stop_callback forward(stop, [&source] { source.request_stop(); });
+        // the first worker that finds a model or proves the problem unsatisfiable reports the answer
+        auto report = [&](SolveResult result, const Solver &solver) {
+            if (source.request_stop()) {
+                outcome.result = result;
+                outcome.model = solver.getModel();
+            }
+        };
+
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(numWorkers);
+            for (std::size_t w = 0; w < numWorkers; ++w) {
+                workers.emplace_back([&, w] {
+                    Solver solver(numVariables);
+                    configure(solver, numVariables, configs[w]);
+                    solver.setStopToken(source.get_token());
+                    for (const auto &clause : clauses) {
+                        if (!solver.addClause(Clause(clause))) {
+                            report(SolveResult::Unsat, solver);
+                            return;
+                        }
+                    }
+
+                    std::vector<std::vector<Literal>> knownCores;
+                    while (!source.stop_requested()) {
+                        auto task = queues[w].pop();
+                        for (std::size_t k = 1; k < numWorkers && !task.has_value(); ++k) {
+                            task = queues[(w + k) % numWorkers].steal();
+                        }
+
+                        if (!task.has_value()) {
+                            return;
+                        }
+
+                        {
+                            std::lock_guard lock(coresMutex);
+                            for (std::size_t i = knownCores.size(); i < cores.size(); ++i) {
+                                knownCores.emplace_back(cores[i]);
+                                std::vector<Literal> blocking;
+                                std::ranges::transform(cores[i], std::back_inserter(blocking),
+                                                       [](Literal l) { return l.negate(); });
+                                solver.addClause(Clause(std::move(blocking)));
+                            }
+                        }
+
+                        const auto &cube = cubes[*task];
+                        const bool pruned = std::ranges::any_of(knownCores, [&cube](const auto &core) {
+                            return std::ranges::includes(cube, core, {}, [](Literal l) { return l.get(); },
+                                                         [](Literal l) { return l.get(); });
+                        });
+
+                        if (pruned) {
+                            ++prunedCubes;
+                            continue;
+                        }
+
+                        ++solvedCubes;
+                        const auto result = solver.solve(cube);
+                        if (result == SolveResult::Sat) {
+                            report(SolveResult::Sat, solver);
+                        } else if (result == SolveResult::Unknown) {
+                            // e.g. memory limit exceeded => the cube is not refuted
+                            unresolved = true;
+                        } else {
+                            auto core = solver.getCore();
+                            if (core.empty()) {
+                                report(SolveResult::Unsat, solver);
+                                return;
+                            }
+
+                            std::ranges::sort(core, {}, [](Literal l) { return l.get(); });
+                            std::lock_guard lock(coresMutex);
+                            cores.emplace_back(std::move(core));
+                        }
+                    }
+                });
+            }
+        } // workers are joined here
+
+        // the cubes cover all models => if all of them are refuted, so is the problem
+        if (!source.stop_requested() && !unresolved) {
+            outcome.result = SolveResult::Unsat;
+        }
+
+        outcome.solvedCubes = solvedCubes;
+        outcome.prunedCubes = prunedCubes;
+        return outcome;
+    }
+}
@@ -0,0 +1,95 @@
+/**
+* @date 16.10.26
+* @file CubeAndConquer.hpp
+* @brief Contains the lookahead cube generator and the parallel cube solver
+*/
+
+#ifndef CUBEANDCONQUER_HPP
+#define CUBEANDCONQUER_HPP
+
+#include <vector>
+#include <cstddef>
+#include <stop_token>
+
+#include "basic_structures.hpp"
+#include "Solver.hpp"
+#include "Portfolio.hpp"
+
+namespace sat {
+    /**
+     * @brief Splits a problem into cubes (partial assignments) by lookahead.
+     * @details @copybrief
+     * At every node of the split tree, the candidate variables are assigned in both polarities and propagated. The
+     * variable whose polarities propagate the most (product of both counts) becomes the branching variable. If one
+     * polarity leads to a conflict, the other one is implied and added to the cube. If both lead to a conflict, the
+     * cube is refuted and dropped. The leaves of the tree are the cubes.
+     */
+    class CubeGenerator {
+        Solver solver;
+        unsigned numVariables;
+        std::vector<std::size_t> occurrences; ///< per variable: number of clauses containing the variable
+        std::vector<Literal> cube;
+        std::vector<std::vector<Literal>> cubes;
+        bool unsat = false;
+
+        /// number of variables with the most occurrences that are considered for branching. Variables without any
+        /// occurrence are never considered
+        static constexpr std::size_t MaxCandidates = 64;
+
+        /**
+         * Opens a decision level, assigns the given literal and propagates
+         * @param l literal to assign
+         * @return number of assigned variables after propagation, 0 if there was a conflict
+         */
+        std::size_t lookahead(Literal l);
+
+        /**
+         * Splits the current node of the split tree
+         * @param depth remaining depth
+         */
+        void split(unsigned depth);
+
+    public:
+        /**
+         * Ctor
+         * @param clauses clauses of the problem
+         * @param numVariables number of variables in the problem
+         */
+        CubeGenerator(const std::vector<std::vector<Literal>> &clauses, unsigned numVariables);
+
+        /**
+         * Generates the cubes
+         * @param depth maximum number of branching decisions per cube. At most 2^depth cubes are generated
+         * @return cubes that cover all models of the problem. Empty if the problem was found unsatisfiable
+         */
+        std::vector<std::vector<Literal>> generate(unsigned depth);
+    };
+
+    /**
+     * @brief Outcome of a cube-and-conquer run
+     */
+    struct CubeResult {
+        SolveResult result = SolveResult::Unknown;
+        std::vector<TruthValue> model; ///< model if result is SolveResult::Sat
+        std::size_t cubes = 0; ///< number of generated cubes
+        std::size_t solvedCubes = 0; ///< number of cubes passed to a solver
+        std::size_t prunedCubes = 0; ///< number of cubes skipped because they contain a refuted core
+    };
+
+    /**
+     * Solves a problem by cube-and-conquer. The cubes of a CubeGenerator are distributed round robin to the work
+     * stealing queues of the workers. Each worker owns an incremental solver and solves its cubes under assumptions.
+     * The failed assumptions of every refuted cube are shared: all workers add their negation as clause and skip cubes
+     * that contain them. The first model found cancels the other workers
+     * @param clauses clauses of the problem
+     * @param numVariables number of variables in the problem
+     * @param configs configuration per worker (at least one)
+     * @param depth split depth of the cube generator
+     * @param stop stop token through which the whole run can be cancelled
+     * @return the answer. SolveResult::Unknown if cancelled through stop
+     */
+    CubeResult solveCubes(const std::vector<std::vector<Literal>> &clauses, unsigned numVariables,
+                          const std::vector<SolverConfig> &configs, unsigned depth, std::stop_token stop = {});
+}
+
+#endif //CUBEANDCONQUER_HPP
@@ -0,0 +1,259 @@
+/**
+* @date 16.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "LocalSearch.hpp"
+#include "util/random.hpp"
+
+namespace sat {
+    namespace {
+        /**
+         * Gets the base of the exponential ProbSAT break function for clauses with more than three literals
+         * @param maxClauseSize maximum number of literals of a clause
+         * @return base cb of f(b) = cb^-b
+         */
+        double exponentialBase(std::size_t maxClauseSize) {
+            constexpr double Bases[] = {3.0, 3.7, 5.1, 5.4}; ///< for 4, 5, 6 and at least 7 literals
+            return Bases[std::min<std::size_t>(maxClauseSize, 7) - 4];
+        }
+    }
+
+    LocalSearch::LocalSearch(const std::vector<std::vector<Literal>> &clauses, unsigned numVariables)
+        : numVariables(numVariables), values(numVariables, 0), breaks(numVariables, 0),
+          bestFalsified(std::numeric_limits<std::size_t>::max()) {
+        std::vector<std::uint32_t> counts(2 * numVariables, 0);
+        std::vector<Literal> literals;
+        std::size_t maxClauseSize = 0;
+        clauseStarts.emplace_back(0);
+        for (const auto &clause : clauses) {
+            literals = clause;
+            std::ranges::sort(literals, {}, [](Literal l) { return l.get(); });
+            const auto duplicates = std::ranges::unique(literals);
+            literals.erase(duplicates.begin(), duplicates.end());
+            // after sorting, both literals of a variable are adjacent
+            const bool tautology = std::ranges::adjacent_find(literals, [](Literal a, Literal b) {
+                return a.negate() == b;
+            }) != literals.end();
+
+            if (tautology) {
+                continue;
+            }
+
+            for (Literal l : literals) {
+                ++counts[l.get()];
+                clauseLiterals.emplace_back(l);
+            }
+
+            clauseStarts.emplace_back(static_cast<std::uint32_t>(clauseLiterals.size()));
+            maxClauseSize = std::max(maxClauseSize, literals.size());
+        }
+
+        occurrenceStarts.resize(2 * numVariables + 1, 0);
+        for (std::size_t lit = 0; lit < counts.size(); ++lit) {
+            occurrenceStarts[lit + 1] = occurrenceStarts[lit] + counts[lit];
+        }
+
+        const auto numClauses = static_cast<std::uint32_t>(clauseStarts.size() - 1);
+        occurrences.resize(clauseLiterals.size());
+        std::vector<std::uint32_t> cursors(occurrenceStarts.begin(), occurrenceStarts.end() - 1);
+        for (std::uint32_t clause = 0; clause < numClauses; ++clause) {
+            for (auto i = clauseStarts[clause]; i < clauseStarts[clause + 1]; ++i) {
+                occurrences[cursors[clauseLiterals[i].get()]++] = clause;
+            }
+        }
+
+        numTrue.resize(numClauses);
+        trueVariables.resize(numClauses);
+        falsifiedPositions.resize(numClauses);
+        probabilities.resize(MaxBreak + 1);
+        for (std::uint32_t b = 0; b <= MaxBreak; ++b) {
+            probabilities[b] = maxClauseSize <= 3 ? std::pow(PolyEps + b, -PolyCb)
+                                                  : std::pow(exponentialBase(maxClauseSize), -static_cast<double>(b));
+        }
+
+        for (auto &value : values) {
+            value = static_cast<std::int8_t>(RNG::get().random_int(0, 1));
+        }
+
+        initialize();
+    }
+
+    bool LocalSearch::isTrue(Literal l) const noexcept {
+        return values[var(l).get()] == static_cast<std::int8_t>(l.get() & 1u);
+    }
+
+    void LocalSearch::makeFalsified(std::uint32_t clause) {
+        falsifiedPositions[clause] = static_cast<std::uint32_t>(falsified.size());
+        falsified.emplace_back(clause);
+    }
+
+    void LocalSearch::makeSatisfied(std::uint32_t clause) {
+        const auto position = falsifiedPositions[clause];
+        const auto last = falsified.back();
+        falsified[position] = last;
+        falsifiedPositions[last] = position;
+        falsified.pop_back();
+    }
+
+    void LocalSearch::flip(unsigned varId) {
+        values[varId] ^= 1;
+        const Literal satisfied = values[varId] ? pos(varId) : neg(varId);
+        for (auto i = occurrenceStarts[satisfied.get()]; i < occurrenceStarts[satisfied.get() + 1]; ++i) {
+            const auto clause = occurrences[i];
+            const auto count = numTrue[clause]++;
+            if (count == 0) {
+                makeSatisfied(clause);
+                ++breaks[varId];
+            } else if (count == 1) {
+                // the previously only true variable is no longer critical
+                --breaks[trueVariables[clause]];
+            }
+
+            trueVariables[clause] ^= varId;
+        }
+
+        const Literal falsifiedLiteral = satisfied.negate();
+        for (auto i = occurrenceStarts[falsifiedLiteral.get()]; i < occurrenceStarts[falsifiedLiteral.get() + 1]; ++i) {
+            const auto clause = occurrences[i];
+            trueVariables[clause] ^= varId;
+            const auto count = --numTrue[clause];
+            if (count == 0) {
+                makeFalsified(clause);
+                --breaks[varId];
+            } else if (count == 1) {
+                ++breaks[trueVariables[clause]];
+            }
+        }
+
+        ++numFlips;
+    }
+
+    void LocalSearch::initialize() {
+        std::ranges::fill(breaks, 0);
+        falsified.clear();
+        for (std::uint32_t clause = 0; clause < numTrue.size(); ++clause) {
+            numTrue[clause] = 0;
+            trueVariables[clause] = 0;
+            for (auto i = clauseStarts[clause]; i < clauseStarts[clause + 1]; ++i) {
+                if (isTrue(clauseLiterals[i])) {
+                    ++numTrue[clause];
+                    trueVariables[clause] ^= var(clauseLiterals[i]).get();
+                }
+            }
+
+            if (numTrue[clause] == 0) {
+                makeFalsified(clause);
+            } else if (numTrue[clause] == 1) {
+                ++breaks[trueVariables[clause]];
+            }
+        }
+
+        best = values;
+        bestFalsified = falsified.size();
+        flipsSinceBest.clear();
+        bestOutdated = false;
+    }
+
+    void LocalSearch::setAssignment(const std::vector<TruthValue> &assignment) {
+        for (unsigned varId = 0; varId < numVariables; ++varId) {
+            values[varId] = assignment[varId] == TruthValue::Undefined
+                                ? static_cast<std::int8_t>(RNG::get().random_int(0, 1))
+                                : static_cast<std::int8_t>(assignment[varId] == TruthValue::True);
+        }
+
+        initialize();
+    }
+
+    SolveResult LocalSearch::search(std::size_t maxFlips, std::stop_token stop) {
+        constexpr std::size_t StopCheckInterval = 1024;
+        for (std::size_t step = 0; step < maxFlips && !falsified.empty(); ++step) {
+            if (step % StopCheckInterval == 0 && stop.stop_requested()) {
+                break;
+            }
+
+            const auto clause = falsified[RNG::get().random_int<std::size_t>(0, falsified.size() - 1)];
+            const auto begin = clauseStarts[clause];
+            const auto end = clauseStarts[clause + 1];
+            if (begin == end) {
+                // the empty clause cannot be satisfied
+                break;
+            }
+
+            weights.clear();
+            double sum = 0;
+            for (auto i = begin; i < end; ++i) {
+                sum += probabilities[std::min(breaks[var(clauseLiterals[i]).get()], MaxBreak)];
+                weights.emplace_back(sum);
+            }
+
+            const auto threshold = RNG::get().random_float(0.0, sum);
+            const auto selected = std::min<std::size_t>(std::ranges::upper_bound(weights, threshold) - weights.begin(),
+                                                        end - begin - 1);
+            const auto varId = var(clauseLiterals[begin + selected]).get();
+            flip(varId);
+            if (!bestOutdated) {
+                flipsSinceBest.emplace_back(varId);
+                bestOutdated = flipsSinceBest.size() > numVariables;
+            }
+
+            if (falsified.size() < bestFalsified) {
+                bestFalsified = falsified.size();
+                if (bestOutdated) {
+                    best = values;
+                } else {
+                    for (auto flipped : flipsSinceBest) {
+                        best[flipped] ^= 1;
+                    }
+                }
+
+                flipsSinceBest.clear();
+                bestOutdated = false;
+            }
+        }
+
+        return falsified.empty() ? SolveResult::Sat : SolveResult::Unknown;
+    }
+
+    std::vector<TruthValue> LocalSearch::getAssignment() const {
+        std::vector<TruthValue> assignment(numVariables);
+        std::ranges::transform(values, assignment.begin(), [](std::int8_t value) {
+            return value ? TruthValue::True : TruthValue::False;
+        });
+
+        return assignment;
+    }
+
+    std::vector<TruthValue> LocalSearch::getBestAssignment() const {
+        std::vector<TruthValue> assignment(numVariables);
+        std::ranges::transform(best, assignment.begin(), [](std::int8_t value) {
+            return value ? TruthValue::True : TruthValue::False;
+        });
+
+        return assignment;
+    }
+
+    std::size_t LocalSearch::numFalsified() const noexcept {
+        return falsified.size();
+    }
+
+    std::size_t LocalSearch::numBestFalsified() const noexcept {
+        return bestFalsified;
+    }
+
+    std::size_t LocalSearch::getNumFlips() const noexcept {
+        return numFlips;
+    }
+
+    bool initializePhases(Solver &solver, const std::vector<std::vector<Literal>> &clauses, unsigned numVariables,
+                          std::size_t maxFlips, std::stop_token stop) {
+        LocalSearch localSearch(clauses, numVariables);
+        const auto result = localSearch.search(maxFlips, std::move(stop));
+        solver.setPhases(localSearch.getBestAssignment());
+        return result == SolveResult::Sat;
+    }
+}
@@ -0,0 +1,141 @@
+/**
+* @date 16.10.26
+* @file LocalSearch.hpp
+* @brief Contains the ProbSAT stochastic local search engine
+*/
+
+#ifndef LOCALSEARCH_HPP
+#define LOCALSEARCH_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <stop_token>
+
+#include "basic_structures.hpp"
+#include "Solver.hpp"
+
+namespace sat {
+    /**
+     * @brief Stochastic local search (ProbSAT) on a complete assignment.
+     * @details @copybrief
+     * Each step picks a random falsified clause and flips one of its variables. A variable with break value b (number
+     * of clauses that become falsified by the flip) is picked with probability proportional to f(b). f is polynomial
+     * for 3-SAT and exponential for longer clauses and is precomputed per break value. Clauses, occurrence lists, true
+     * literal counts, break values and the falsified clauses are kept in flat arrays and are updated incrementally on
+     * every flip. Local search cannot prove unsatisfiability.
+     */
+    class LocalSearch {
+        unsigned numVariables;
+        std::vector<std::uint32_t> clauseStarts; ///< per clause: position of its first literal, followed by the end
+        std::vector<Literal> clauseLiterals;
+        std::vector<std::uint32_t> occurrenceStarts; ///< per literal: position of its first clause, followed by the end
+        std::vector<std::uint32_t> occurrences; ///< clauses containing the literal, grouped by literal
+        std::vector<std::int8_t> values; ///< per variable: 1 if true, 0 if false
+        std::vector<std::uint32_t> numTrue; ///< per clause: number of satisfied literals
+        /// per clause: xor of the variables of its satisfied literals => the only one if numTrue is 1
+        std::vector<std::uint32_t> trueVariables;
+        std::vector<std::uint32_t> breaks; ///< per variable: number of clauses in which it is the only true variable
+        std::vector<std::uint32_t> falsified; ///< falsified clauses in no particular order
+        std::vector<std::uint32_t> falsifiedPositions; ///< per clause: position in falsified (if falsified)
+        std::vector<double> probabilities; ///< per break value: unnormalized probability of a flip
+        std::vector<double> weights; ///< scratch buffer: cumulated probabilities of the literals of a clause
+        std::vector<std::int8_t> best; ///< assignment with the fewest falsified clauses so far
+        std::size_t bestFalsified;
+        /// variables flipped since best was recorded. Once there are more flips than variables, the next improvement
+        /// copies the whole assignment instead (see bestOutdated)
+        std::vector<unsigned> flipsSinceBest;
+        bool bestOutdated = false; ///< whether flipsSinceBest is incomplete
+        std::size_t numFlips = 0;
+
+        /// break values above this limit share the probability of the limit
+        static constexpr std::uint32_t MaxBreak = 64;
+        static constexpr double PolyEps = 1; ///< ProbSAT poly break parameter for 3-SAT
+        static constexpr double PolyCb = 2.38; ///< ProbSAT poly break parameter for 3-SAT
+
+        bool isTrue(Literal l) const noexcept;
+
+        void makeFalsified(std::uint32_t clause);
+
+        void makeSatisfied(std::uint32_t clause);
+
+        /**
+         * Flips the value of a variable and updates true literal counts, break values and falsified clauses
+         * @param varId the variable
+         */
+        void flip(unsigned varId);
+
+        /**
+         * Recomputes all counters from the current values
+         */
+        void initialize();
+
+    public:
+        /**
+         * Ctor. Duplicate literals are removed, tautologies are ignored. The initial assignment is random
+         * @param clauses clauses of the problem
+         * @param numVariables number of variables in the problem
+         */
+        LocalSearch(const std::vector<std::vector<Literal>> &clauses, unsigned numVariables);
+
+        /**
+         * Replaces the current assignment
+         * @param assignment per variable: truth value. Undefined values are drawn at random
+         */
+        void setAssignment(const std::vector<TruthValue> &assignment);
+
+        /**
+         * Runs local search from the current assignment
+         * @param maxFlips maximum number of flips
+         * @param stop stop token through which the search can be cancelled
+         * @return SolveResult::Sat if all clauses are satisfied (see getAssignment), SolveResult::Unknown otherwise
+         */
+        SolveResult search(std::size_t maxFlips, std::stop_token stop = {});
+
+        /**
+         * Gets the current assignment
+         * @return per variable: truth value
+         */
+        std::vector<TruthValue> getAssignment() const;
+
+        /**
+         * Gets the assignment with the fewest falsified clauses encountered so far
+         * @return per variable: truth value
+         */
+        std::vector<TruthValue> getBestAssignment() const;
+
+        /**
+         * Gets the number of clauses falsified by the current assignment
+         * @return number of falsified clauses
+         */
+        std::size_t numFalsified() const noexcept;
+
+        /**
+         * Gets the number of clauses falsified by the best assignment (see getBestAssignment)
+         * @return number of falsified clauses
+         */
+        std::size_t numBestFalsified() const noexcept;
+
+        /**
+         * Gets the number of flips performed so far
+         * @return number of flips
+         */
+        std::size_t getNumFlips() const noexcept;
+    };
+
+    /**
+     * Runs local search on the clauses and passes the best assignment as phases to the solver (see
+     * Solver::setPhases). If local search finds a model, the first descent of the solver reproduces it without
+     * conflicts
+     * @param solver the solver, must contain the same clauses
+     * @param clauses clauses of the problem
+     * @param numVariables number of variables in the problem
+     * @param maxFlips maximum number of flips
+     * @param stop stop token through which local search can be cancelled
+     * @return whether local search found a model
+     */
+    bool initializePhases(Solver &solver, const std::vector<std::vector<Literal>> &clauses, unsigned numVariables,
+                          std::size_t maxFlips, std::stop_token stop = {});
+}
+
+#endif //LOCALSEARCH_HPP
@@ -0,0 +1,109 @@
+/**
+* @date 16.10.26
+* @brief
+*/
+
+#include <thread>
+
+#include "Portfolio.hpp"
+#include "ClauseExchange.hpp"
+#include "LocalSearch.hpp"
+#include "util/random.hpp"
+
+namespace sat {
+    namespace {
+        /// threshold used by configurations that enable chronological backtracking
+        constexpr unsigned PortfolioChronoThreshold = 100;
+    }
+
+    void configure(Solver &solver, unsigned numVariables, const SolverConfig &config) {
+        RNG::get().setSeed(config.seed);
+        solver.setHeuristic(makeHeuristic(config.heuristic, numVariables, solver.getEvents()));
+        solver.setRestartPolicy(makeRestartPolicy(config.restarts));
+        solver.setChronoThreshold(config.chronoThreshold);
+        solver.setMemoryLimit(config.memoryLimit);
+        if (config.randomPhases) {
+            std::vector<TruthValue> phases(numVariables);
+            for (auto &phase : phases) {
+                phase = RNG::get().random_int(0, 1) ? TruthValue::True : TruthValue::False;
+            }
+
+            solver.setPhases(phases);
+        }
+    }
+
+    std::vector<SolverConfig> makePortfolio(unsigned numWorkers, const SolverConfig &base) {
+        std::vector<SolverConfig> configs(numWorkers, base);
+        // each bit of the worker index flips one option of the base configuration
+        for (unsigned i = 1; i < numWorkers; ++i) {
+            auto &config = configs[i];
+            config.seed = base.seed + i;
+            if (i & 1) {
+                config.heuristic = base.heuristic == BranchingStrategy::EVSIDS ? BranchingStrategy::VMTF
+                                                                               : BranchingStrategy::EVSIDS;
+            }
+
+            if (i & 2) {
+                config.restarts = base.restarts == RestartStrategy::Glucose ? RestartStrategy::Luby
+                                                                            : RestartStrategy::Glucose;
+            }
+
+            if (i & 4) {
+                config.randomPhases = !base.randomPhases;
+            }
+
+            if (i & 8) {
+                config.chronoThreshold = base.chronoThreshold == std::numeric_limits<unsigned>::max()
+                                             ? PortfolioChronoThreshold
+                                             : std::numeric_limits<unsigned>::max();
+            }
+        }
+
+        return configs;
+    }
+
+    PortfolioResult solvePortfolio(const std::vector<std::vector<Literal>> &clauses, unsigned numVariables,
+                                   const std::vector<SolverConfig> &configs, std::stop_token stop) {
+        PortfolioResult outcome;
+        ClauseExchange exchange(configs.size());
+        std::stop_source source;
+        std::stop_callback forward(stop, [&source] { source.request_stop(); });
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(configs.size());
+            for (std::size_t i = 0; i < configs.size(); ++i) {
+                // a single worker has no one to share clauses with
+                auto sharing = configs.size() > 1 ? exchange.connect(i) : ClauseSharing{};
+                workers.emplace_back([&, i, sharing = std::move(sharing)]() mutable {
+                    Solver solver(numVariables);
+                    configure(solver, numVariables, configs[i]);
+                    solver.setStopToken(source.get_token());
+                    solver.setClauseSharing(std::move(sharing));
+                    bool consistent = true;
+                    for (const auto &clause : clauses) {
+                        if (!solver.addClause(Clause(clause))) {
+                            consistent = false;
+                            break;
+                        }
+                    }
+
+                    if (consistent && configs[i].localSearchFlips > 0) {
+                        initializePhases(solver, clauses, numVariables, configs[i].localSearchFlips,
+                                         source.get_token());
+                    }
+
+                    const auto result = solver.solve();
+                    // request_stop succeeds for exactly one caller => only the first answer is reported
+                    if (result != SolveResult::Unknown && source.request_stop()) {
+                        outcome.result = result;
+                        outcome.model = solver.getModel();
+                        outcome.stats = solver.getStatistics();
+                        outcome.winner = i;
+                    }
+                });
+            }
+        } // workers are joined here
+
+        return outcome;
+    }
+}
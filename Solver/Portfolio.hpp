@@ -0,0 +1,78 @@
+/**
+* @date 16.10.26
+* @file Portfolio.hpp
+* @brief Contains the multi-threaded portfolio solver
+*/
+
+#ifndef PORTFOLIO_HPP
+#define PORTFOLIO_HPP
+
+#include <vector>
+#include <cstddef>
+#include <limits>
+#include <stop_token>
+
+#include "basic_structures.hpp"
+#include "Solver.hpp"
+#include "heuristics.hpp"
+#include "restart.hpp"
+
+namespace sat {
+    /**
+     * @brief Configuration of a single solver instance
+     */
+    struct SolverConfig {
+        unsigned seed = 1337; ///< seed of the random number generator of the solver's thread
+        BranchingStrategy heuristic = BranchingStrategy::EVSIDS;
+        RestartStrategy restarts = RestartStrategy::Glucose;
+        /// see Solver::setChronoThreshold. The default disables chronological backtracking
+        unsigned chronoThreshold = std::numeric_limits<unsigned>::max();
+        bool randomPhases = false; ///< whether the initial phases are drawn at random instead of all false
+        /// see Solver::setMemoryLimit. The default does not limit the memory
+        std::size_t memoryLimit = std::numeric_limits<std::size_t>::max();
+        /// flips of local search whose best assignment initializes the phases (see initializePhases). 0 disables it
+        std::size_t localSearchFlips = 0;
+    };
+
+    /**
+     * @brief Outcome of a portfolio run
+     */
+    struct PortfolioResult {
+        SolveResult result = SolveResult::Unknown;
+        std::vector<TruthValue> model; ///< model found by the winner if result is SolveResult::Sat
+        Statistics stats; ///< search statistics of the winner
+        std::size_t winner = 0; ///< index of the configuration that found the answer
+    };
+
+    /**
+     * Applies a configuration to a solver. Seeds the random number generator of the calling thread
+     * @param solver the solver
+     * @param numVariables number of variables of the solver
+     * @param config configuration to apply
+     */
+    void configure(Solver &solver, unsigned numVariables, const SolverConfig &config);
+
+    /**
+     * Creates diversified configurations. The first configuration is the base configuration. The others differ in
+     * seed and alternate heuristic, restart strategy, initial phases and chronological backtracking
+     * @param numWorkers number of configurations
+     * @param base base configuration
+     * @return one configuration per worker
+     */
+    std::vector<SolverConfig> makePortfolio(unsigned numWorkers, const SolverConfig &base = {});
+
+    /**
+     * Solves a problem with one solver instance per configuration, each on its own thread. The instances share short
+     * learned clauses through a ClauseExchange. The first instance to find an answer cancels the others. The clauses
+     * are shared by all threads and are only read
+     * @param clauses clauses of the problem
+     * @param numVariables number of variables in the problem
+     * @param configs configuration per solver instance (at least one)
+     * @param stop stop token through which the whole portfolio can be cancelled
+     * @return answer of the first instance that finished. SolveResult::Unknown if cancelled through stop
+     */
+    PortfolioResult solvePortfolio(const std::vector<std::vector<Literal>> &clauses, unsigned numVariables,
+                                   const std::vector<SolverConfig> &configs, std::stop_token stop = {});
+}
+
+#endif //PORTFOLIO_HPP
@@ -0,0 +1,449 @@
+/**
+* @date 16.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <span>
+#include <limits>
+#include <iterator>
+#include <optional>
+
+#include "Preprocessor.hpp"
+
+namespace sat {
+    Preprocessor::Preprocessor(unsigned numVariables, std::size_t blockingStepLimit)
+        : numVariables(numVariables), occurrences(2 * numVariables), values(2 * numVariables, 0),
+          eliminated(numVariables, 0), frozen(numVariables, 0), marks(2 * numVariables, 0),
+          blockingStepLimit(blockingStepLimit) {}
+
+    bool Preprocessor::addClause(std::vector<Literal> literals) {
+        if (unsat) {
+            return false;
+        }
+
+        // after sorting, duplicates and complementary literals are adjacent
+        std::ranges::sort(literals, {}, [](Literal l) { return l.get(); });
+        literals.erase(std::unique(literals.begin(), literals.end()), literals.end());
+        for (std::size_t i = 1; i < literals.size(); ++i) {
+            if (literals[i - 1] == literals[i].negate()) {
+                return true;
+            }
+        }
+
+        store(literals);
+        return !unsat;
+    }
+
+    void Preprocessor::store(const std::vector<Literal> &literals) {
+        std::vector<Literal> open;
+        open.reserve(literals.size());
+        for (Literal l : literals) {
+            if (values[l.get()] > 0) {
+                return;
+            }
+
+            if (values[l.get()] == 0) {
+                open.emplace_back(l);
+            }
+        }
+
+        if (open.empty()) {
+            unsat = true;
+        } else if (open.size() == 1) {
+            fix(open.front());
+        } else {
+            const ClauseRef cref = clauses.alloc(open, false);
+            clauseRefs.emplace_back(cref);
+            for (Literal l : open) {
+                occurrences[l.get()].emplace_back(cref);
+            }
+        }
+    }
+
+    void Preprocessor::remove(ClauseRef cref) {
+        clauses.free(cref);
+    }
+
+    void Preprocessor::removeWithPivot(ClauseRef cref, Literal pivot) {
+        reconstructionStarts.emplace_back(reconstruction.size());
+        reconstruction.emplace_back(pivot);
+        for (Literal l : clauses[cref]) {
+            if (l != pivot) {
+                reconstruction.emplace_back(l);
+            }
+        }
+
+        remove(cref);
+    }
+
+    const std::vector<ClauseRef> &Preprocessor::liveOccurrences(Literal l) {
+        auto &occurrenceList = occurrences[l.get()];
+        std::erase_if(occurrenceList, [this](ClauseRef cref) { return clauses[cref].deleted(); });
+        return occurrenceList;
+    }
+
+    void Preprocessor::fix(Literal l) {
+        if (values[l.get()] < 0) {
+            unsat = true;
+        } else if (values[l.get()] == 0) {
+            values[l.get()] = 1;
+            values[l.negate().get()] = -1;
+            units.emplace_back(l);
+        }
+    }
+
+    bool Preprocessor::propagate() {
+        std::vector<Literal> strengthened;
+        while (unitHead < units.size() && !unsat) {
+            const Literal l = units[unitHead++];
+            // the occurrence lists are modified while clauses are removed and stored => iterate over copies
+            for (ClauseRef cref : std::vector(liveOccurrences(l))) {
+                remove(cref);
+            }
+
+            for (ClauseRef cref : std::vector(liveOccurrences(l.negate()))) {
+                strengthened.clear();
+                for (Literal other : clauses[cref]) {
+                    if (other != l.negate()) {
+                        strengthened.emplace_back(other);
+                    }
+                }
+
+                remove(cref);
+                store(strengthened);
+            }
+        }
+
+        stats.fixedVariables = units.size();
+        return !unsat;
+    }
+
+    bool Preprocessor::subsume() {
+        // shorter clauses are used first, so that subsumed clauses are removed before they are used as subsumer
+        std::vector<ClauseRef> candidates;
+        for (ClauseRef cref : clauseRefs) {
+            if (!clauses[cref].deleted()) {
+                candidates.emplace_back(cref);
+            }
+        }
+
+        std::ranges::stable_sort(candidates, {}, [this](ClauseRef cref) { return clauses[cref].size(); });
+        std::vector<Literal> strengthened;
+        for (ClauseRef subsumer : candidates) {
+            if (stopToken.stop_requested()) {
+                break;
+            }
+
+            if (clauses[subsumer].deleted()) {
+                continue;
+            }
+
+            // every clause subsumed or strengthened by the subsumer contains its literal with the fewest occurrences
+            // in either polarity
+            Literal pivot = clauses[subsumer][0];
+            std::size_t minOccurrences = std::numeric_limits<std::size_t>::max();
+            for (Literal l : clauses[subsumer]) {
+                const auto numOccurrences = liveOccurrences(l).size() + liveOccurrences(l.negate()).size();
+                if (numOccurrences < minOccurrences) {
+                    minOccurrences = numOccurrences;
+                    pivot = l;
+                }
+            }
+
+            if (minOccurrences > MaxSubsumptionOccurrences) {
+                continue;
+            }
+
+            const auto size = clauses[subsumer].size();
+            const auto signature = clauses[subsumer].signature();
+            for (Literal l : clauses[subsumer]) {
+                marks[l.get()] = 1;
+            }
+
+            for (Literal candidateLit : {pivot, pivot.negate()}) {
+                for (ClauseRef other : std::vector(liveOccurrences(candidateLit))) {
+                    const auto clause = clauses[other];
+                    if (other == subsumer || clause.deleted() || clause.size() < size ||
+                        (signature & ~clause.signature()) != 0) {
+                        continue;
+                    }
+
+                    std::uint32_t numSame = 0;
+                    std::uint32_t numFlipped = 0;
+                    Literal flipped = pivot;
+                    for (Literal l : clause) {
+                        if (marks[l.get()]) {
+                            ++numSame;
+                        } else if (marks[l.negate().get()]) {
+                            ++numFlipped;
+                            flipped = l;
+                        }
+                    }
+
+                    if (numSame == size) {
+                        ++stats.subsumedClauses;
+                        remove(other);
+                    } else if (numSame + 1 == size && numFlipped == 1) {
+                        ++stats.strengthenedClauses;
+                        strengthened.clear();
+                        std::ranges::copy_if(clause, std::back_inserter(strengthened),
+                                             [flipped](Literal l) { return l != flipped; });
+                        remove(other);
+                        store(strengthened);
+                    }
+                }
+            }
+
+            for (Literal l : clauses[subsumer]) {
+                marks[l.get()] = 0;
+            }
+
+            if (unsat) {
+                return false;
+            }
+        }
+
+        return propagate();
+    }
+
+    bool Preprocessor::resolve(ClauseRef posClause, ClauseRef negClause, Variable pivot) {
+        resolvent.clear();
+        for (Literal l : clauses[posClause]) {
+            if (var(l) != pivot) {
+                resolvent.emplace_back(l);
+                marks[l.get()] = 1;
+            }
+        }
+
+        bool tautology = false;
+        const auto numPos = resolvent.size();
+        for (Literal l : clauses[negClause]) {
+            if (var(l) == pivot || marks[l.get()]) {
+                continue;
+            }
+
+            if (marks[l.negate().get()]) {
+                tautology = true;
+                break;
+            }
+
+            resolvent.emplace_back(l);
+        }
+
+        for (std::size_t i = 0; i < numPos; ++i) {
+            marks[resolvent[i].get()] = 0;
+        }
+
+        return !tautology;
+    }
+
+    bool Preprocessor::isBlocked(Literal l, std::size_t &steps) {
+        for (ClauseRef other : liveOccurrences(l.negate())) {
+            const auto clause = clauses[other];
+            steps += clause.size();
+            const bool tautology = std::ranges::any_of(clause, [this, l](Literal m) {
+                return m != l.negate() && marks[m.negate().get()];
+            });
+
+            if (!tautology) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void Preprocessor::eliminateBlocked() {
+        std::size_t steps = 0;
+        bool changed = true;
+        // removing a clause can block other clauses => repeat until fixpoint
+        while (changed && steps < blockingStepLimit && !stopToken.stop_requested()) {
+            changed = false;
+            for (ClauseRef cref : clauseRefs) {
+                if (steps >= blockingStepLimit || stopToken.stop_requested()) {
+                    break;
+                }
+
+                const auto clause = clauses[cref];
+                if (clause.deleted()) {
+                    continue;
+                }
+
+                for (Literal l : clause) {
+                    marks[l.get()] = 1;
+                }
+
+                std::optional<Literal> blocking;
+                for (Literal l : clause) {
+                    if (!frozen[var(l).get()] && isBlocked(l, steps)) {
+                        blocking = l;
+                        break;
+                    }
+                }
+
+                for (Literal l : clause) {
+                    marks[l.get()] = 0;
+                }
+
+                if (blocking.has_value()) {
+                    ++stats.blockedClauses;
+                    changed = true;
+                    removeWithPivot(cref, *blocking);
+                }
+            }
+        }
+    }
+
+    bool Preprocessor::tryEliminate(Variable x) {
+        if (eliminated[x.get()] || frozen[x.get()] || values[pos(x).get()] != 0) {
+            return false;
+        }
+
+        const auto posClauses = liveOccurrences(pos(x));
+        const auto negClauses = liveOccurrences(neg(x));
+        if (posClauses.size() * negClauses.size() > MaxResolutions) {
+            return false;
+        }
+
+        // check that the clause count does not grow before modifying anything
+        const std::size_t limit = posClauses.size() + negClauses.size();
+        std::size_t numResolvents = 0;
+        for (ClauseRef p : posClauses) {
+            for (ClauseRef n : negClauses) {
+                if (resolve(p, n, x) && (resolvent.size() > MaxResolventSize || ++numResolvents > limit)) {
+                    return false;
+                }
+            }
+        }
+
+        for (auto [clauseList, pivot] : {std::pair{&posClauses, pos(x)}, std::pair{&negClauses, neg(x)}}) {
+            for (ClauseRef cref : *clauseList) {
+                removeWithPivot(cref, pivot);
+            }
+        }
+
+        for (ClauseRef p : posClauses) {
+            for (ClauseRef n : negClauses) {
+                if (resolve(p, n, x)) {
+                    ++stats.resolvents;
+                    store(resolvent);
+                }
+            }
+        }
+
+        eliminated[x.get()] = 1;
+        ++stats.eliminatedVariables;
+        return true;
+    }
+
+    void Preprocessor::freeze(Variable x) {
+        frozen[x.get()] = 1;
+    }
+
+    void Preprocessor::setStopToken(std::stop_token token) {
+        stopToken = std::move(token);
+    }
+
+    bool Preprocessor::eliminate() {
+        if (!propagate() || !subsume()) {
+            return false;
+        }
+
+        // removing blocked clauses first reduces the number of occurrences and thus the cost of BVE
+        eliminateBlocked();
+
+        std::vector<unsigned> candidates;
+        std::vector<std::size_t> numOccurrences(numVariables);
+        for (unsigned round = 0; round < MaxRounds && !stopToken.stop_requested(); ++round) {
+            // variables with few occurrences are cheap to eliminate and are tried first
+            candidates.clear();
+            for (unsigned varId = 0; varId < numVariables; ++varId) {
+                if (!eliminated[varId] && !frozen[varId] && values[pos(varId).get()] == 0) {
+                    candidates.emplace_back(varId);
+                    numOccurrences[varId] = liveOccurrences(pos(varId)).size() + liveOccurrences(neg(varId)).size();
+                }
+            }
+
+            std::ranges::sort(candidates, {}, [&numOccurrences](unsigned varId) { return numOccurrences[varId]; });
+            bool changed = false;
+            for (unsigned varId : candidates) {
+                if (stopToken.stop_requested()) {
+                    break;
+                }
+
+                if (tryEliminate(varId)) {
+                    changed = true;
+                    if (!propagate()) {
+                        return false;
+                    }
+                }
+            }
+
+            if (!changed) {
+                break;
+            }
+
+            // resolvents may subsume or strengthen other clauses
+            if (!subsume()) {
+                return false;
+            }
+        }
+
+        return !unsat;
+    }
+
+    bool Preprocessor::isEliminated(Variable x) const {
+        return eliminated[x.get()];
+    }
+
+    std::vector<std::vector<Literal>> Preprocessor::getClauses() const {
+        std::vector<std::vector<Literal>> result;
+        if (unsat) {
+            result.emplace_back();
+            return result;
+        }
+
+        for (Literal l : units) {
+            result.emplace_back(std::vector{l});
+        }
+
+        for (ClauseRef cref : clauseRefs) {
+            const auto clause = clauses[cref];
+            if (!clause.deleted()) {
+                result.emplace_back(clause.begin(), clause.end());
+            }
+        }
+
+        return result;
+    }
+
+    void Preprocessor::extend(std::vector<TruthValue> &model) const {
+        for (unsigned varId = 0; varId < numVariables; ++varId) {
+            if (eliminated[varId] && model[varId] == TruthValue::Undefined) {
+                model[varId] = TruthValue::False;
+            }
+        }
+
+        // removed clauses are visited in reverse order. Flipping the pivot of a falsified clause cannot falsify a
+        // clause that was present when it was removed, since their resolvent is either a tautology or was added to the
+        // problem
+        std::size_t end = reconstruction.size();
+        for (auto start = reconstructionStarts.rbegin(); start != reconstructionStarts.rend(); ++start) {
+            const auto clause = std::span(reconstruction).subspan(*start, end - *start);
+            end = *start;
+            const bool satisfied = std::ranges::any_of(clause, [&model](Literal l) {
+                return model[var(l).get()] == static_cast<TruthValue>(l.sign());
+            });
+
+            if (!satisfied) {
+                const Literal pivot = clause.front();
+                model[var(pivot).get()] = static_cast<TruthValue>(pivot.sign());
+            }
+        }
+    }
+
+    auto Preprocessor::getStatistics() const -> const Statistics & {
+        return stats;
+    }
+}
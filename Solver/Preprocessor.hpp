@@ -0,0 +1,214 @@
+/**
+* @date 16.10.26
+* @file Preprocessor.hpp
+* @brief Contains the preprocessor that simplifies a problem before search
+*/
+
+#ifndef PREPROCESSOR_HPP
+#define PREPROCESSOR_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <stop_token>
+
+#include "basic_structures.hpp"
+#include "ClauseArena.hpp"
+
+namespace sat {
+    /**
+     * @brief SatELite style preprocessor.
+     * @details @copybrief
+     * Simplifies a problem by unit propagation, subsumption, self-subsuming resolution, blocked clause elimination
+     * (BCE) and bounded variable elimination (BVE). A clause is blocked on one of its literals l if all resolvents with
+     * clauses containing ~l are tautologies. A variable is eliminated by replacing all clauses that contain it with
+     * their non-tautological resolvents, as long as this does not increase the number of clauses. Removed clauses are
+     * kept on a reconstruction stack in order to extend models of the simplified problem to the eliminated variables
+     * and blocked clauses.
+     */
+    class Preprocessor {
+    public:
+        /**
+         * @brief Preprocessing statistics
+         */
+        struct Statistics {
+            std::size_t eliminatedVariables = 0; ///< number of variables removed by BVE
+            std::size_t fixedVariables = 0; ///< number of variables fixed by unit propagation
+            std::size_t resolvents = 0; ///< number of resolvents added by BVE
+            std::size_t subsumedClauses = 0; ///< number of clauses removed by subsumption
+            std::size_t strengthenedClauses = 0; ///< number of literals removed by self-subsuming resolution
+            std::size_t blockedClauses = 0; ///< number of clauses removed by BCE
+        };
+
+    private:
+        unsigned numVariables;
+        ClauseArena clauses;
+        std::vector<ClauseRef> clauseRefs; ///< all clauses ever stored, including deleted ones
+        std::vector<std::vector<ClauseRef>> occurrences; ///< per literal: clauses containing it (possibly deleted)
+        std::vector<std::int8_t> values; ///< per literal: 1 if fixed to true, -1 if fixed to false, 0 otherwise
+        std::vector<Literal> units; ///< fixed literals in the order they were found
+        std::size_t unitHead = 0; ///< position of the next unit to propagate
+        std::vector<char> eliminated; ///< per variable: whether the variable was eliminated
+        std::vector<char> frozen; ///< per variable: whether the variable must not be eliminated
+        std::vector<char> marks; ///< per literal: marker used for resolution and subsumption
+        std::vector<Literal> resolvent;
+        /// removed clauses in elimination order. Each clause starts with the literal of the eliminated variable
+        std::vector<Literal> reconstruction;
+        std::vector<std::size_t> reconstructionStarts; ///< start of each removed clause in reconstruction
+        bool unsat = false;
+        std::size_t blockingStepLimit;
+        std::stop_token stopToken; ///< checked between clauses and variables, eliminate returns once stop is requested
+        Statistics stats;
+
+        /// variables with more candidate resolvents are not considered for elimination
+        static constexpr std::size_t MaxResolutions = 4096;
+        /// variables whose elimination produces a resolvent longer than this are not eliminated
+        static constexpr std::size_t MaxResolventSize = 24;
+        static constexpr unsigned MaxRounds = 3;
+        /// clauses whose literals all occur more often than this are not used for subsumption
+        static constexpr std::size_t MaxSubsumptionOccurrences = 1000;
+
+    public:
+        /// default number of literal visits spent on blocked clause elimination
+        static constexpr std::size_t DefaultBlockingStepLimit = 20'000'000;
+
+    private:
+
+        /**
+         * Stores a clause without literals that are fixed to false. Satisfied clauses are dropped, unit clauses are
+         * fixed
+         * @param literals literals without duplicates or complementary literals
+         */
+        void store(const std::vector<Literal> &literals);
+
+        /**
+         * Removes a clause from the problem
+         * @param cref the clause
+         */
+        void remove(ClauseRef cref);
+
+        /**
+         * Removes a clause from the problem and pushes it onto the reconstruction stack
+         * @param cref the clause
+         * @param pivot literal of the clause that is flipped during reconstruction if the clause is falsified
+         */
+        void removeWithPivot(ClauseRef cref, Literal pivot);
+
+        /**
+         * Removes deleted clauses from the occurrence list of a literal
+         * @param l the literal
+         * @return live clauses containing the literal
+         */
+        const std::vector<ClauseRef> &liveOccurrences(Literal l);
+
+        /**
+         * Fixes a literal to true
+         * @param l the literal
+         */
+        void fix(Literal l);
+
+        /**
+         * Simplifies the clauses with all pending fixed literals
+         * @return false if the problem was found unsatisfiable, true otherwise
+         */
+        bool propagate();
+
+        /**
+         * Computes the resolvent of two clauses on the given pivot variable and stores it in resolvent
+         * @param posClause clause containing the positive pivot literal
+         * @param negClause clause containing the negative pivot literal
+         * @param pivot the variable resolved on
+         * @return false if the resolvent is a tautology, true otherwise
+         */
+        bool resolve(ClauseRef posClause, ClauseRef negClause, Variable pivot);
+
+        /**
+         * Removes clauses subsumed by another clause and strengthens clauses by self-subsuming resolution: if
+         * C = A | l and D = A | B | ~l, then ~l can be removed from D. Candidate pairs are filtered by their signatures
+         * @return false if the problem was found unsatisfiable, true otherwise
+         */
+        bool subsume();
+
+        /**
+         * Checks whether the currently marked clause is blocked on the given literal
+         * @param l literal of the marked clause
+         * @param steps number of visited literals, increased by the literals visited during the check
+         * @return true if all resolvents on l are tautologies, false otherwise
+         */
+        bool isBlocked(Literal l, std::size_t &steps);
+
+        /**
+         * Removes blocked clauses until no more clauses are blocked or the step limit is exhausted. Literals of frozen
+         * variables are never used as blocking literals
+         */
+        void eliminateBlocked();
+
+        /**
+         * Eliminates the given variable if the number of clauses does not grow
+         * @param x candidate variable
+         * @return true if the variable was eliminated, false otherwise
+         */
+        bool tryEliminate(Variable x);
+
+    public:
+        /**
+         * Ctor
+         * @param numVariables number of variables in the problem
+         * @param blockingStepLimit maximum number of literal visits spent on blocked clause elimination. 0 disables BCE
+         */
+        explicit Preprocessor(unsigned numVariables, std::size_t blockingStepLimit = DefaultBlockingStepLimit);
+
+        /**
+         * Adds a clause of the problem
+         * @param literals literals of the clause
+         * @return false if the problem is known to be unsatisfiable, true otherwise
+         */
+        bool addClause(std::vector<Literal> literals);
+
+        /**
+         * Prevents a variable from being eliminated, e.g. because it is used as assumption later on
+         * @param x the variable
+         */
+        void freeze(Variable x);
+
+        /**
+         * Sets the stop token through which a running call to eliminate can be cancelled, e.g. from another thread.
+         * A cancelled call leaves a partially simplified problem that is still equisatisfiable
+         * @param token stop token. By default, the preprocessor cannot be stopped
+         */
+        void setStopToken(std::stop_token token);
+
+        /**
+         * Runs unit propagation, subsumption, blocked clause elimination and bounded variable elimination
+         * @return false if the problem was found unsatisfiable, true otherwise
+         */
+        bool eliminate();
+
+        /**
+         * Whether the given variable was eliminated. Eliminated variables do not occur in the simplified clauses
+         * @param x the variable
+         * @return true if variable was eliminated
+         */
+        bool isEliminated(Variable x) const;
+
+        /**
+         * Gets the simplified problem. Fixed literals are contained as unit clauses
+         * @return clauses of the simplified problem
+         */
+        std::vector<std::vector<Literal>> getClauses() const;
+
+        /**
+         * Extends a model of the simplified problem to a model of the original problem by assigning the eliminated
+         * variables
+         * @param model model of the simplified problem, truth values of eliminated variables are overwritten
+         */
+        void extend(std::vector<TruthValue> &model) const;
+
+        /**
+         * Gets the preprocessing statistics
+         */
+        const Statistics &getStatistics() const;
+    };
+}
+
+#endif //PREPROCESSOR_HPP
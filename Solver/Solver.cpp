@@ -4,141 +4,1486 @@
 * @brief
 */
 
+#include <algorithm>
+#include <cassert>
+#include <set>
+#include <limits>
+#include <Iterators.hpp>
+
 #include "Solver.hpp"
 #include "util/exception.hpp"
+#include "util/random.hpp"
 
 namespace sat {
-   Solver::Solver(unsigned numVariables)
-    : numVariables(numVariables), model(numVariables, TruthValue::Undefined) {
-    for (unsigned i = 0; i < numVariables; ++i) {
-        Variable var(i);
-        literals.push_back(pos(var)); 
-        literals.push_back(neg(var)); 
+    Solver::Solver(unsigned numVariables) : Solver(numVariables, Heuristic{}) {
+        heuristic = makeHeuristic(BranchingStrategy::EVSIDS, numVariables, events);
+    }
+
+    Solver::Solver(unsigned numVariables, Heuristic heuristic)
+        : numVariables(numVariables), model(numVariables, TruthValue::Undefined), values(2 * numVariables, 0),
+          watches(2 * numVariables),
+          binaryWatches(2 * numVariables),
+          levels(numVariables, 0), reasons(numVariables, NoReason), seen(numVariables, 0),
+          heuristic(std::move(heuristic)), restartPolicy(GlucoseRestarts{}), levelStamps(numVariables + 1, 0),
+          nextReduction(FirstReduction),
+          reductionInterval(FirstReduction), savedPhases(numVariables, -1), targetPhases(numVariables, 0),
+          bestPhases(numVariables, 0), nextRephase(RephaseInterval),
+          nextSubsumption(SubsumptionInterval), substituted(numVariables, 0), substitutes(numVariables, 0) {
+        trail.reserve(numVariables);
+    }
+
+    void Solver::watch(Literal l, ClauseRef cref, Literal blocker) {
+        watches[l.get()].emplace_back(cref, blocker);
+    }
+
+    Solver::TrialScope::TrialScope(Solver &solver) : solver(solver), phases(solver.savedPhases) {}
+
+    Solver::TrialScope::~TrialScope() {
+        solver.savedPhases = std::move(phases);
+    }
+
+    ClauseRef Solver::TrialScope::propagate() {
+        return solver.propagateAll(propagations);
+    }
+
+    ClauseRef Solver::attachClause(const std::vector<Literal> &literals, bool learned) {
+        const ClauseRef cref = clauses.alloc(literals, learned);
+        (learned ? learnts : originals).emplace_back(cref);
+        if (literals.size() == 2) {
+            binaryWatches[literals[0].get()].emplace_back(literals[1], cref);
+            binaryWatches[literals[1].get()].emplace_back(literals[0], cref);
+        } else {
+            watch(literals[0], cref, literals[1]);
+            watch(literals[1], cref, literals[0]);
+        }
+
+        return cref;
     }
-}
 
     bool Solver::addClause(Clause clause) {
-        if (clause.isEmpty()) return false; 
-        clauses.push_back(std::make_shared<Clause>(clause)); 
+        backtrack(0);
+        if (clause.isEmpty()) {
+            conflicting = true;
+            return false;
+        }
+
+        // the clause ctor sorts the literals => duplicates and complementary literals are adjacent
+        auto lits = clause.getLiterals();
+        if (std::ranges::any_of(lits, [this](Literal l) { return substituted[var(l).get()]; })) {
+            std::ranges::transform(lits, lits.begin(), [this](Literal l) { return representative(l); });
+            std::ranges::sort(lits, {}, [](Literal l) { return l.get(); });
+        }
+
+        lits.erase(std::unique(lits.begin(), lits.end()), lits.end());
+        for (std::size_t i = 1; i < lits.size(); ++i) {
+            if (lits[i - 1] == lits[i].negate()) {
+                return true;
+            }
+        }
+
+        if (lits.size() == 1) {
+            conflicting |= !assign(lits.front());
+            return !conflicting;
+        }
+
+        // move literals that are not falsified to the front, they become the watchers
+        const auto openEnd = std::stable_partition(lits.begin(), lits.end(), [this](Literal l) {
+            return !falsified(l);
+        });
+        const auto numOpen = openEnd - lits.begin();
+        if (numOpen == 0) {
+            conflicting = true;
+            return false;
+        }
+
+        const ClauseRef cref = attachClause(lits, false);
+        if (numOpen == 1 && val(var(lits.front())) == TruthValue::Undefined) {
+            enqueue(lits.front(), cref);
+        }
+
         return true;
     }
 
     auto Solver::rebase() const -> std::vector<Clause> {
         std::vector<Clause> reducedClauses;
+        std::set<std::vector<unsigned>> known;
+        for (const auto *clauseList : {&originals, &learnts}) {
+            for (ClauseRef cref : *clauseList) {
+                bool isSatisfied = false;
+                std::vector<Literal> reducedLiterals;
+                for (Literal literal : clauses[cref]) {
+                    if (satisfied(literal)) {
+                        isSatisfied = true;
+                        break;
+                    }
 
-        for (const auto& clausePtr : clauses) {
-            bool isSatisfied = false;            
-            std::vector<Literal> reducedLiterals;
+                    if (!falsified(literal)) {
+                        reducedLiterals.push_back(literal);
+                    }
+                }
 
-            for (const auto& literal : *clausePtr) {
-                if (satisfied(literal)) {
-                    isSatisfied = true; 
-                    break; 
+                if (isSatisfied || reducedLiterals.empty()) {
+                    continue;
                 }
-                if (!falsified(literal)) {
-                    reducedLiterals.push_back(literal); 
+
+                std::vector<unsigned> key;
+                key.reserve(reducedLiterals.size());
+                std::ranges::transform(reducedLiterals, std::back_inserter(key), [](Literal l) { return l.get(); });
+                std::ranges::sort(key);
+                if (known.insert(std::move(key)).second) {
+                    reducedClauses.emplace_back(std::move(reducedLiterals));
                 }
             }
+        }
 
-            if (!isSatisfied && !reducedLiterals.empty()) {               
-                reducedClauses.emplace_back(reducedLiterals);
+        for (Literal l : trail) {
+            if (!substituted[var(l).get()]) {
+                reducedClauses.emplace_back(std::vector<Literal>{l});
             }
         }
 
-        for (unsigned i = 0; i < model.size(); ++i) {
-            if (model[i] == TruthValue::True) {
-                reducedClauses.emplace_back(std::vector<Literal>{pos(Variable(i))});
-            } else if (model[i] == TruthValue::False) {
-                reducedClauses.emplace_back(std::vector<Literal>{neg(Variable(i))});
+        // substituted variables occur in no clause, their equivalences are restored
+        for (unsigned varId = 0; varId < numVariables; ++varId) {
+            if (!substituted[varId]) {
+                continue;
+            }
+
+            const Literal r = representative(pos(varId));
+            if (satisfied(r) || falsified(r)) {
+                reducedClauses.emplace_back(std::vector{satisfied(r) ? pos(varId) : neg(varId)});
+            } else {
+                reducedClauses.emplace_back(std::vector{neg(varId), r});
+                reducedClauses.emplace_back(std::vector{pos(varId), r.negate()});
             }
         }
 
         return reducedClauses;
-}
-
+    }
 
     TruthValue Solver::val(Variable x) const {
-    return model[x.get()];
+        return static_cast<TruthValue>(values[pos(x).get()]);
     }
 
     bool Solver::satisfied(Literal l) const {
-       TruthValue valVariable = val(var(l)); 
-    if (l.sign() > 0) { 
-        return valVariable == TruthValue::True;
-    } else { 
-        return valVariable == TruthValue::False;
-    }
+        return values[l.get()] > 0;
     }
 
     bool Solver::falsified(Literal l) const {
-      TruthValue valVariable = val(var(l)); 
-    if (l.sign() > 0) { 
-        return valVariable == TruthValue::False;
-    } else { 
-        return valVariable == TruthValue::True;
+        return values[l.get()] < 0;
     }
+
+    void Solver::enqueue(Literal l, ClauseRef reason) {
+        enqueue(l, reason, currentLevel());
+    }
+
+    void Solver::enqueue(Literal l, ClauseRef reason, unsigned level) {
+        const auto varId = var(l).get();
+        values[l.get()] = 1;
+        values[l.negate().get()] = -1;
+        model[varId] = static_cast<TruthValue>(l.sign());
+        levels[varId] = level;
+        reasons[varId] = reason;
+        trail.emplace_back(l);
+        if (events.assign.hasSubscribers()) {
+            events.assign.trigger(Variable(varId));
+        }
     }
 
     bool Solver::assign(Literal l) {
         if (falsified(l)) return false;
-        if (val(var(l)) == TruthValue::Undefined) {
-            model[var(l).get()] = (l.sign() > 0) ? TruthValue::True : TruthValue::False;
-            std::vector<Literal> unitLiterals;
-            unitLiterals.push_back(l);
-            Clause unitClause = Clause(unitLiterals); 
-            clauses.push_back(std::make_shared<Clause>(unitClause));
+        if (!satisfied(l)) {
+            enqueue(l, NoReason);
+        }
+
+        return true;
+    }
+
+    unsigned Solver::level(Variable x) const {
+        return levels[x.get()];
+    }
+
+    ClauseRef Solver::reason(Variable x) const {
+        return reasons[x.get()];
+    }
+
+    unsigned Solver::currentLevel() const {
+        return static_cast<unsigned>(trailLimits.size());
+    }
+
+    std::size_t Solver::numAssignments() const {
+        return trail.size();
+    }
+
+    void Solver::newDecisionLevel() {
+        trailLimits.emplace_back(trail.size());
+        // repeated or implied assumptions each open a level, so the level can exceed the number of variables
+        if (levelStamps.size() <= currentLevel()) {
+            levelStamps.resize(currentLevel() + 1, 0);
+        }
+    }
+
+    void Solver::backtrack(unsigned level) {
+        if (level >= currentLevel()) {
+            return;
         }
-        return satisfied(l);
+
+        const std::size_t limit = trailLimits[level];
+        const bool notifyUnassign = events.unassign.hasSubscribers();
+        outOfOrder.clear();
+        for (std::size_t i = trail.size(); i > limit; --i) {
+            const Literal l = trail[i - 1];
+            const auto varId = var(l).get();
+            if (levels[varId] <= level) {
+                outOfOrder.emplace_back(l);
+                continue;
+            }
+
+            values[l.get()] = values[l.negate().get()] = 0;
+            model[varId] = TruthValue::Undefined;
+            reasons[varId] = NoReason;
+            savedPhases[varId] = static_cast<std::int8_t>(l.sign());
+            if (notifyUnassign) {
+                events.unassign.trigger(Variable(varId));
+            }
+        }
+
+        trail.erase(trail.begin() + static_cast<std::ptrdiff_t>(limit), trail.end());
+        // kept literals stay in trail order and are propagated again, since clauses watching them may have lost their
+        // satisfied literal
+        trail.insert(trail.end(), outOfOrder.rbegin(), outOfOrder.rend());
+        trailLimits.resize(level);
+        queueHead = std::min(queueHead, limit);
+        binaryQueueHead = std::min(binaryQueueHead, limit);
+    }
+
+    ClauseRef Solver::propagateBinary(Literal falseLit) {
+        for (const auto &[implied, cref] : binaryWatches[falseLit.get()]) {
+            if (satisfied(implied)) {
+                continue;
+            }
+
+            if (falsified(implied)) {
+                return cref;
+            }
+
+            enqueue(implied, cref, levels[var(falseLit).get()]);
+        }
+
+        return NoReason;
+    }
+
+    ClauseRef Solver::propagate(Literal falseLit) {
+        auto &watchList = watches[falseLit.get()];
+        std::size_t keep = 0;
+        for (std::size_t i = 0; i < watchList.size(); ++i) {
+            if (satisfied(watchList[i].blocker)) {
+                watchList[keep++] = watchList[i];
+                continue;
+            }
+
+            const ClauseRef cref = watchList[i].cref;
+            auto clause = clauses[cref];
+            if (clause[0] == falseLit) {
+                clause.swap(0, 1);
+            }
+
+            // falseLit is now at position 1
+            const Literal other = clause[0];
+            if (satisfied(other)) {
+                watchList[keep++] = {cref, other};
+                continue;
+            }
+
+            // look for a replacement watcher that is not falsified
+            bool moved = false;
+            for (std::uint32_t k = 2; k < clause.size(); ++k) {
+                const Literal candidate = clause[k];
+                if (!falsified(candidate)) {
+                    clause.swap(1, k);
+                    watch(candidate, cref, other);
+                    moved = true;
+                    break;
+                }
+            }
+
+            if (moved) {
+                continue;
+            }
+
+            // clause is unit or falsified
+            watchList[keep++] = {cref, other};
+            if (falsified(other)) {
+                for (++i; i < watchList.size(); ++i) {
+                    watchList[keep++] = watchList[i];
+                }
+
+                watchList.erase(watchList.begin() + static_cast<std::ptrdiff_t>(keep), watchList.end());
+                return cref;
+            }
+
+            // all other literals are falsified. If falseLit was assigned out of order, the clause may be unit on a
+            // lower level
+            unsigned level = levels[var(falseLit).get()];
+            if (level < currentLevel()) {
+                for (std::uint32_t k = 2; k < clause.size(); ++k) {
+                    level = std::max(level, levels[var(clause[k]).get()]);
+                }
+            }
+
+            enqueue(other, cref, level);
+        }
+
+        watchList.erase(watchList.begin() + static_cast<std::ptrdiff_t>(keep), watchList.end());
+        return NoReason;
+    }
+
+    ClauseRef Solver::propagateAll() {
+        return propagateAll(stats.propagations);
+    }
+
+    ClauseRef Solver::propagateAll(std::size_t &propagations) {
+        while (queueHead < trail.size()) {
+            while (binaryQueueHead < trail.size()) {
+                const ClauseRef conflict = propagateBinary(trail[binaryQueueHead++].negate());
+                if (conflict != NoReason) {
+                    queueHead = binaryQueueHead = trail.size();
+                    return conflict;
+                }
+            }
+
+            ++propagations;
+            const ClauseRef conflict = propagate(trail[queueHead++].negate());
+            if (conflict != NoReason) {
+                queueHead = binaryQueueHead = trail.size();
+                return conflict;
+            }
+        }
+
+        return NoReason;
     }
 
     bool Solver::unitPropagate() {
-        bool changed = true;
-        std::vector<std::shared_ptr<Clause>> currentClauses;
-        
-        while (changed) {
-            changed = false;
-            currentClauses.clear();
-            
-            for (const auto& clausePtr : clauses) {
-                if (clausePtr) {
-                    currentClauses.push_back(clausePtr);
-                }
-            }
-            
-            for (const auto& clausePtr : currentClauses) {
-                Literal unitLiteral(0);
-                int unassignedCount = 0;
-                bool clauseSatisfied = false;
-                
-                for (const auto& literal : *clausePtr) {
-                    if (satisfied(literal)) {
-                        clauseSatisfied = true;
-                        break;
+        return propagateAll() == NoReason;
+    }
+
+    unsigned Solver::analyze(ClauseRef conflict, std::vector<Literal> &learnt) {
+        learnt.clear();
+        learnt.emplace_back(0); // placeholder for the asserting literal
+        conflictVariables.clear();
+        unsigned pathCount = 0;
+        std::size_t trailIdx = trail.size();
+        ClauseRef cref = conflict;
+        // the literal whose reason is currently resolved, it is the only true literal in that clause
+        Literal resolved = 0;
+        bool first = true;
+        do {
+            if (clauses[cref].learned()) {
+                bumpClause(cref);
+            }
+
+            for (Literal l : clauses[cref]) {
+                const auto varId = var(l).get();
+                if ((!first && l == resolved) || seen[varId] || levels[varId] == 0) {
+                    continue;
+                }
+
+                seen[varId] = 1;
+                conflictVariables.emplace_back(varId);
+                if (levels[varId] == currentLevel()) {
+                    ++pathCount;
+                } else {
+                    learnt.emplace_back(l);
+                }
+            }
+
+            // next marked literal of the conflict level on the trail. Literals of lower levels may be interleaved
+            while (!seen[var(trail[--trailIdx]).get()] || levels[var(trail[trailIdx]).get()] != currentLevel()) {}
+            resolved = trail[trailIdx];
+            cref = reasons[var(resolved).get()];
+            seen[var(resolved).get()] = 0;
+            first = false;
+            --pathCount;
+        } while (pathCount > 0);
+
+        learnt.front() = resolved.negate();
+        minimize(learnt);
+        unsigned backjumpLevel = 0;
+        std::size_t maxIdx = 1;
+        for (std::size_t i = 1; i < learnt.size(); ++i) {
+            const auto varId = var(learnt[i]).get();
+            if (levels[varId] > backjumpLevel) {
+                backjumpLevel = levels[varId];
+                maxIdx = i;
+            }
+        }
+
+        if (learnt.size() > 1) {
+            std::swap(learnt[1], learnt[maxIdx]);
+        }
+
+        return backjumpLevel;
+    }
+
+    void Solver::minimize(std::vector<Literal> &learnt) {
+        minimizationMarked.clear();
+        std::uint32_t levelMask = 0;
+        for (std::size_t i = 1; i < learnt.size(); ++i) {
+            const auto varId = var(learnt[i]).get();
+            minimizationMarked.emplace_back(varId);
+            levelMask |= 1u << (levels[varId] & 31);
+        }
+
+        std::size_t keep = 1;
+        for (std::size_t i = 1; i < learnt.size(); ++i) {
+            if (reasons[var(learnt[i]).get()] == NoReason || !isRedundant(learnt[i], levelMask)) {
+                learnt[keep++] = learnt[i];
+            }
+        }
+
+        stats.minimizedLiterals += learnt.size() - keep;
+        learnt.erase(learnt.begin() + static_cast<std::ptrdiff_t>(keep), learnt.end());
+        for (unsigned varId : minimizationMarked) {
+            seen[varId] = 0;
+        }
+    }
+
+    bool Solver::isRedundant(Literal l, std::uint32_t levelMask) {
+        minimizationStack.clear();
+        minimizationStack.emplace_back(var(l).get(), 0);
+        while (!minimizationStack.empty()) {
+            const auto [varId, next] = minimizationStack.back();
+            const auto reason = clauses[reasons[varId]];
+            if (next == reason.size()) {
+                // all literals of the reason are implied => so is the variable. The root keeps its Source mark
+                if (minimizationStack.size() > 1) {
+                    seen[varId] = Removable;
+                    minimizationMarked.emplace_back(varId);
+                }
+
+                minimizationStack.pop_back();
+                continue;
+            }
+
+            ++minimizationStack.back().second;
+            const auto otherId = var(reason[next]).get();
+            if (otherId == varId || levels[otherId] == 0 || seen[otherId] == Source || seen[otherId] == Removable) {
+                continue;
+            }
+
+            if (seen[otherId] == Poison || reasons[otherId] == NoReason ||
+                (levelMask & (1u << (levels[otherId] & 31))) == 0) {
+                // every variable on the stack depends on the failed one
+                for (std::size_t i = 1; i < minimizationStack.size(); ++i) {
+                    seen[minimizationStack[i].first] = Poison;
+                    minimizationMarked.emplace_back(minimizationStack[i].first);
+                }
+
+                return false;
+            }
+
+            minimizationStack.emplace_back(otherId, 0);
+        }
+
+        return true;
+    }
+
+    void Solver::learn(const std::vector<Literal> &learnt, unsigned lbd, unsigned level) {
+        ++stats.learnedClauses;
+        if (sharing.exportClause && sharing.exportClause(learnt, lbd)) {
+            ++stats.exportedClauses;
+        }
+
+        if (learnt.size() == 1) {
+            enqueue(learnt.front(), NoReason, 0);
+            return;
+        }
+
+        const ClauseRef cref = attachClause(learnt, true);
+        auto clause = clauses[cref];
+        clause.setLbd(lbd);
+        clause.setTier(tierFor(lbd));
+        enqueue(learnt.front(), cref, level);
+    }
+
+    unsigned Solver::maxLevel(ClauseRef cref) const {
+        unsigned level = 0;
+        for (Literal l : clauses[cref]) {
+            level = std::max(level, levels[var(l).get()]);
+        }
+
+        return level;
+    }
+
+    ClauseTier Solver::tierFor(unsigned lbd) noexcept {
+        return lbd <= CoreMaxLbd ? ClauseTier::Core : lbd <= MidMaxLbd ? ClauseTier::Mid : ClauseTier::Local;
+    }
+
+    template<typename Literals>
+    unsigned Solver::computeLbd(const Literals &literals) {
+        ++currentStamp;
+        unsigned lbd = 0;
+        for (Literal l : literals) {
+            const auto lvl = levels[var(l).get()];
+            if (levelStamps[lvl] != currentStamp) {
+                levelStamps[lvl] = currentStamp;
+                ++lbd;
+            }
+        }
+
+        return lbd;
+    }
+
+    void Solver::bumpClause(ClauseRef cref) {
+        auto clause = clauses[cref];
+        clause.setUsed(true);
+        if (clause.imported()) {
+            clause.setImported(false);
+            ++stats.usefulImports;
+        }
+
+        if (clause.tier() == ClauseTier::Core) {
+            return;
+        }
+
+        const auto lbd = computeLbd(clause);
+        if (lbd < clause.lbd()) {
+            clause.setLbd(lbd);
+            if (lbd <= CoreMaxLbd) {
+                clause.setTier(ClauseTier::Core);
+            } else if (lbd <= MidMaxLbd) {
+                clause.setTier(ClauseTier::Mid);
+            }
+        }
+    }
+
+    bool Solver::isLocked(ClauseRef cref) const {
+        // binary clauses are propagated without moving the implied literal to the front
+        const auto clause = clauses[cref];
+        return (reasons[var(clause[0]).get()] == cref && satisfied(clause[0])) ||
+               (reasons[var(clause[1]).get()] == cref && satisfied(clause[1]));
+    }
+
+    void Solver::analyzeFinal(Literal failed) {
+        core.clear();
+        core.emplace_back(failed);
+        const Literal assigned = representative(failed);
+        if (levels[var(assigned).get()] == 0) {
+            return;
+        }
+
+        // walk back through the implication graph of the negated assumption, decisions are assumptions
+        seen[var(assigned).get()] = 1;
+        for (std::size_t i = trail.size(); i > trailLimits.front(); --i) {
+            const Literal l = trail[i - 1];
+            const auto varId = var(l).get();
+            if (!seen[varId]) {
+                continue;
+            }
+
+            seen[varId] = 0;
+            if (reasons[varId] == NoReason) {
+                // the decision of level k is assumption k - 1, possibly replaced by its representative
+                core.emplace_back(assumptions[levels[varId] - 1]);
+                continue;
+            }
+
+            for (Literal reasonLit : clauses[reasons[varId]]) {
+                const auto reasonVar = var(reasonLit).get();
+                if (reasonVar != varId && levels[reasonVar] > 0) {
+                    seen[reasonVar] = 1;
+                }
+            }
+        }
+    }
+
+    void Solver::updateTargetPhases() {
+        // the assignments of the conflict level are not conflict free
+        const std::size_t consistent = trailLimits.back();
+        if (consistent > targetSize) {
+            targetSize = consistent;
+            std::ranges::fill(targetPhases, 0);
+            for (std::size_t i = 0; i < consistent; ++i) {
+                targetPhases[var(trail[i]).get()] = static_cast<std::int8_t>(trail[i].sign());
+            }
+        }
+
+        if (consistent > bestSize) {
+            bestSize = consistent;
+            std::ranges::fill(bestPhases, 0);
+            for (std::size_t i = 0; i < consistent; ++i) {
+                bestPhases[var(trail[i]).get()] = static_cast<std::int8_t>(trail[i].sign());
+            }
+        }
+    }
+
+    void Solver::rephase() {
+        ++stats.rephases;
+        switch (rephaseCount++ % 6) {
+            case 0:
+                std::ranges::fill(savedPhases, -1);
+                break;
+            case 2:
+                std::ranges::fill(savedPhases, 1);
+                break;
+            case 4:
+                for (auto &phase : savedPhases) {
+                    phase = static_cast<std::int8_t>(2 * RNG::get().random_int(0, 1) - 1);
+                }
+
+                break;
+            default:
+                for (auto [saved, best] : iterators::zip(savedPhases, bestPhases)) {
+                    if (best != 0) {
+                        saved = best;
                     }
-                    if (!falsified(literal)) {
-                        unassignedCount++;
-                        unitLiteral = literal;
-                        if (unassignedCount > 1) break; 
+                }
+
+                bestSize = 0;
+        }
+
+        targetPhases = savedPhases;
+        targetSize = 0;
+    }
+
+    Literal Solver::decisionLiteral(Variable x) const {
+        const auto phase = targetPhases[x.get()] != 0 ? targetPhases[x.get()] : savedPhases[x.get()];
+        return phase > 0 ? pos(x) : neg(x);
+    }
+
+    void Solver::reduceLearnts() {
+        ++stats.reductions;
+        std::vector<ClauseRef> candidates;
+        std::size_t keep = 0;
+        for (ClauseRef cref : learnts) {
+            auto clause = clauses[cref];
+            bool protect = clause.size() == 2 || clause.tier() == ClauseTier::Core || isLocked(cref);
+            if (!protect && clause.used()) {
+                protect = true;
+            } else if (!protect && clause.tier() == ClauseTier::Mid) {
+                clause.setTier(ClauseTier::Local);
+                protect = true;
+            }
+
+            clause.setUsed(false);
+            if (protect) {
+                learnts[keep++] = cref;
+            } else {
+                candidates.emplace_back(cref);
+            }
+        }
+
+        learnts.resize(keep);
+        std::ranges::sort(candidates, [this](ClauseRef a, ClauseRef b) {
+            const auto ca = clauses[a];
+            const auto cb = clauses[b];
+            return ca.lbd() > cb.lbd() || (ca.lbd() == cb.lbd() && ca.size() > cb.size());
+        });
+
+        const std::size_t numDelete = candidates.size() / 2;
+        for (std::size_t i = 0; i < candidates.size(); ++i) {
+            if (i < numDelete) {
+                clauses.free(candidates[i]);
+            } else {
+                learnts.emplace_back(candidates[i]);
+            }
+        }
+
+        stats.deletedClauses += numDelete;
+        purgeWatches();
+        if (static_cast<double>(clauses.wasted()) > MaxWastedFraction * static_cast<double>(clauses.size())) {
+            collectGarbage();
+        }
+    }
+
+    bool Solver::subsumeLearnts() {
+        std::vector<std::vector<ClauseRef>> occurrences(2 * numVariables);
+        for (ClauseRef cref : learnts) {
+            for (Literal l : clauses[cref]) {
+                occurrences[l.get()].emplace_back(cref);
+            }
+        }
+
+        // shorter clauses are used first, so that subsumed clauses are removed before they are used as subsumer
+        std::vector<ClauseRef> candidates(learnts);
+        std::ranges::stable_sort(candidates, {}, [this](ClauseRef cref) { return clauses[cref].size(); });
+        std::vector<char> marks(2 * numVariables, 0);
+        std::vector<ClauseRef> strengthened;
+        // strengthened clauses are watched again once all clauses are processed. After the first strengthening, the
+        // first two literals of a clause are not watched anymore and nothing is erased
+        auto detachStrengthened = [this](ClauseRef cref) {
+            const auto clause = clauses[cref];
+            if (clause.size() == 2) {
+                for (Literal l : {clause[0], clause[1]}) {
+                    std::erase_if(binaryWatches[l.get()], [cref](const BinaryWatch &w) { return w.cref == cref; });
+                }
+            } else if (clause.size() > 2) {
+                for (Literal l : {clause[0], clause[1]}) {
+                    std::erase_if(watches[l.get()], [cref](const Watch &w) { return w.cref == cref; });
+                }
+            }
+        };
+
+        for (ClauseRef subsumer : candidates) {
+            if (stopToken.stop_requested()) {
+                break;
+            }
+
+            const auto clause = clauses[subsumer];
+            if (clause.deleted()) {
+                continue;
+            }
+
+            Literal pivot = clause[0];
+            for (Literal l : clause) {
+                marks[l.get()] = 1;
+                if (occurrences[l.get()].size() + occurrences[l.negate().get()].size() <
+                    occurrences[pivot.get()].size() + occurrences[pivot.negate().get()].size()) {
+                    pivot = l;
+                }
+            }
+
+            for (Literal candidateLit : {pivot, pivot.negate()}) {
+                for (ClauseRef other : occurrences[candidateLit.get()]) {
+                    auto otherClause = clauses[other];
+                    // a clause strengthened to a unit is enqueued below
+                    if (other == subsumer || otherClause.deleted() || otherClause.size() < 2 ||
+                        otherClause.size() < clause.size() ||
+                        (clause.signature() & ~otherClause.signature()) != 0 || isLocked(other)) {
+                        continue;
+                    }
+
+                    std::uint32_t numSame = 0;
+                    std::uint32_t numFlipped = 0;
+                    Literal flipped = pivot;
+                    for (Literal l : otherClause) {
+                        if (marks[l.get()]) {
+                            ++numSame;
+                        } else if (marks[l.negate().get()]) {
+                            ++numFlipped;
+                            flipped = l;
+                        }
+                    }
+
+                    if (numSame == clause.size()) {
+                        ++stats.subsumedClauses;
+                        clauses.free(other);
+                    } else if (numSame + 1 == clause.size() && numFlipped == 1) {
+                        ++stats.strengthenedClauses;
+                        detachStrengthened(other);
+                        // remove the flipped literal in place
+                        const std::uint32_t last = otherClause.size() - 1;
+                        for (std::uint32_t i = 0; i < last; ++i) {
+                            if (otherClause[i] == flipped) {
+                                otherClause.set(i, otherClause[last]);
+                                break;
+                            }
+                        }
+
+                        clauses.shrink(other, last);
+                        strengthened.emplace_back(other);
+                    }
+                }
+            }
+
+            for (Literal l : clause) {
+                marks[l.get()] = 0;
+            }
+        }
+
+        // a clause may have been strengthened several times
+        std::ranges::sort(strengthened);
+        const auto duplicates = std::ranges::unique(strengthened);
+        strengthened.erase(duplicates.begin(), duplicates.end());
+        std::vector<Literal> literals;
+        for (ClauseRef cref : strengthened) {
+            auto clause = clauses[cref];
+            if (clause.deleted()) {
+                continue;
+            }
+
+            // on level 0, assigned literals are permanent
+            if (std::ranges::any_of(clause, [this](Literal l) { return satisfied(l); })) {
+                clauses.free(cref);
+                continue;
+            }
+
+            literals.clear();
+            std::ranges::copy_if(clause, std::back_inserter(literals), [this](Literal l) { return !falsified(l); });
+            if (literals.size() <= 1) {
+                clauses.free(cref);
+                if (literals.empty()) {
+                    conflicting = true;
+                    break;
+                }
+
+                enqueue(literals.front(), NoReason);
+                continue;
+            }
+
+            for (std::size_t i = 0; i < literals.size(); ++i) {
+                clause.set(i, literals[i]);
+            }
+
+            clauses.shrink(cref, static_cast<std::uint32_t>(literals.size()));
+            const auto lbd = std::min(clause.lbd(), static_cast<unsigned>(literals.size()));
+            clause.setLbd(lbd);
+            clause.setTier(tierFor(lbd));
+            if (literals.size() == 2) {
+                binaryWatches[literals[0].get()].emplace_back(literals[1], cref);
+                binaryWatches[literals[1].get()].emplace_back(literals[0], cref);
+            } else {
+                watch(literals[0], cref, literals[1]);
+                watch(literals[1], cref, literals[0]);
+            }
+        }
+
+        std::erase_if(learnts, [this](ClauseRef cref) { return clauses[cref].deleted(); });
+        purgeWatches();
+        // clauses strengthened to units must be propagated before the next technique makes trial assignments
+        if (!conflicting && propagateAll() != NoReason) {
+            conflicting = true;
+        }
+
+        return !conflicting;
+    }
+
+    bool Solver::vivifyLearnts() {
+        assert(currentLevel() == 0);
+        // a conflict in a trial level must stem from the trial literals => level 0 must be fully propagated
+        if (propagateAll() != NoReason) {
+            conflicting = true;
+            return false;
+        }
+
+        std::vector<ClauseRef> candidates;
+        for (ClauseRef cref : learnts) {
+            const auto clause = clauses[cref];
+            if (clause.size() > 2 && clause.tier() != ClauseTier::Local) {
+                candidates.emplace_back(cref);
+            }
+        }
+
+        std::ranges::stable_sort(candidates, {}, [this](ClauseRef cref) { return clauses[cref].lbd(); });
+        TrialScope scope(*this);
+        std::vector<Literal> literals;
+        for (ClauseRef cref : candidates) {
+            if (scope.propagations >= VivificationBudget || stopToken.stop_requested()) {
+                break;
+            }
+
+            auto clause = clauses[cref];
+            if (std::ranges::any_of(clause, [this](Literal l) { return satisfied(l); })) {
+                continue;
+            }
+
+            // the clause must not propagate its own literals => detach it during vivification
+            const Literal watch0 = clause[0];
+            const Literal watch1 = clause[1];
+            for (Literal l : {watch0, watch1}) {
+                std::erase_if(watches[l.get()], [cref](const Watch &w) { return w.cref == cref; });
+            }
+
+            literals.clear();
+            newDecisionLevel();
+            for (Literal l : clause) {
+                if (falsified(l)) {
+                    continue;
+                }
+
+                literals.emplace_back(l);
+                if (satisfied(l)) {
+                    break;
+                }
+
+                enqueue(l.negate(), NoReason);
+                if (scope.propagate() != NoReason) {
+                    break;
+                }
+            }
+
+            backtrack(0);
+            if (literals.size() == clause.size()) {
+                watch(watch0, cref, watch1);
+                watch(watch1, cref, watch0);
+                continue;
+            }
+
+            ++stats.vivifiedClauses;
+            stats.vivifiedLiterals += clause.size() - literals.size();
+            const auto lbd = std::min(clause.lbd(), static_cast<unsigned>(literals.size()));
+            if (literals.size() == 1) {
+                clauses.free(cref);
+                // propagated on level 0 right away, so that the next candidates again start from a propagated level 0
+                enqueue(literals.front(), NoReason);
+                if (scope.propagate() != NoReason) {
+                    conflicting = true;
+                    break;
+                }
+
+                continue;
+            }
+
+            // the remaining literals are a subset of the clause => shorten it in place
+            for (std::size_t i = 0; i < literals.size(); ++i) {
+                clause.set(i, literals[i]);
+            }
+
+            clauses.shrink(cref, static_cast<std::uint32_t>(literals.size()));
+            clause.setLbd(lbd);
+            clause.setTier(tierFor(lbd));
+            if (literals.size() == 2) {
+                binaryWatches[literals[0].get()].emplace_back(literals[1], cref);
+                binaryWatches[literals[1].get()].emplace_back(literals[0], cref);
+            } else {
+                watch(literals[0], cref, literals[1]);
+                watch(literals[1], cref, literals[0]);
+            }
+        }
+
+        std::erase_if(learnts, [this](ClauseRef cref) { return clauses[cref].deleted(); });
+        return !conflicting;
+    }
+
+    bool Solver::importClauses() {
+        std::vector<Literal> literals;
+        unsigned lbd = 0;
+        while (sharing.importClause(literals, lbd)) {
+            ++stats.importedClauses;
+            // other solvers may still use variables that were substituted here
+            std::ranges::transform(literals, literals.begin(), [this](Literal l) { return representative(l); });
+            std::ranges::sort(literals, {}, [](Literal l) { return l.get(); });
+            literals.erase(std::unique(literals.begin(), literals.end()), literals.end());
+            bool tautology = false;
+            for (std::size_t i = 1; i < literals.size() && !tautology; ++i) {
+                tautology = literals[i - 1] == literals[i].negate();
+            }
+
+            // on level 0, assigned literals are permanent
+            if (tautology || std::ranges::any_of(literals, [this](Literal l) { return satisfied(l); })) {
+                continue;
+            }
+
+            std::erase_if(literals, [this](Literal l) { return falsified(l); });
+            if (literals.empty()) {
+                conflicting = true;
+                return false;
+            }
+
+            if (literals.size() == 1) {
+                enqueue(literals.front(), NoReason);
+                continue;
+            }
+
+            const auto newLbd = std::min(lbd, static_cast<unsigned>(literals.size()));
+            auto clause = clauses[attachClause(literals, true)];
+            clause.setLbd(newLbd);
+            clause.setTier(tierFor(newLbd));
+            clause.setImported(true);
+        }
+
+        return true;
+    }
+
+    bool Solver::probe() {
+        TrialScope scope(*this);
+        for (unsigned litId = 0; litId < 2 * numVariables && scope.propagations < ProbingBudget &&
+                                 !stopToken.stop_requested(); ++litId) {
+            const Literal probeLit(litId);
+            // only literals that imply something through binary clauses are worth probing
+            if (values[litId] != 0 || binaryWatches[probeLit.negate().get()].empty()) {
+                continue;
+            }
+
+            newDecisionLevel();
+            enqueue(probeLit, NoReason);
+            const bool failed = scope.propagate() != NoReason;
+            backtrack(0);
+            if (failed) {
+                ++stats.failedLiterals;
+                enqueue(probeLit.negate(), NoReason);
+                if (scope.propagate() != NoReason) {
+                    conflicting = true;
+                    break;
+                }
+            }
+        }
+
+        return !conflicting;
+    }
+
+    bool Solver::findRepresentatives(std::vector<Literal> &representatives) const {
+        constexpr unsigned Unvisited = std::numeric_limits<unsigned>::max();
+        const unsigned numLiterals = 2 * numVariables;
+        representatives.clear();
+        for (unsigned litId = 0; litId < numLiterals; ++litId) {
+            representatives.emplace_back(litId);
+        }
+
+        std::vector<unsigned> index(numLiterals, Unvisited);
+        std::vector<unsigned> lowLink(numLiterals, 0);
+        std::vector<char> onStack(numLiterals, 0);
+        std::vector<char> hasRepresentative(numLiterals, 0);
+        std::vector<unsigned> stack;
+        std::vector<std::size_t> stackPosition(numLiterals, 0);
+        std::vector<std::pair<unsigned, std::size_t>> dfs; // literal and position of the next outgoing edge
+        unsigned counter = 0;
+        for (unsigned root = 0; root < numLiterals; ++root) {
+            if (index[root] != Unvisited || values[root] != 0) {
+                continue;
+            }
+
+            index[root] = lowLink[root] = counter++;
+            stackPosition[root] = stack.size();
+            stack.emplace_back(root);
+            onStack[root] = 1;
+            dfs.emplace_back(root, 0);
+            while (!dfs.empty()) {
+                const unsigned current = dfs.back().first;
+                // current -> implied for every binary clause (~current | implied)
+                const auto &successors = binaryWatches[Literal(current).negate().get()];
+                if (dfs.back().second < successors.size()) {
+                    const unsigned next = successors[dfs.back().second++].implied.get();
+                    if (values[next] != 0) {
+                        continue;
+                    }
+
+                    if (index[next] == Unvisited) {
+                        index[next] = lowLink[next] = counter++;
+                        stackPosition[next] = stack.size();
+                        stack.emplace_back(next);
+                        onStack[next] = 1;
+                        dfs.emplace_back(next, 0);
+                    } else if (onStack[next]) {
+                        lowLink[current] = std::min(lowLink[current], index[next]);
                     }
+
+                    continue;
+                }
+
+                dfs.pop_back();
+                if (!dfs.empty()) {
+                    const unsigned parent = dfs.back().first;
+                    lowLink[parent] = std::min(lowLink[parent], lowLink[current]);
                 }
-              
-                if (clauseSatisfied) {
+
+                if (lowLink[current] != index[current]) {
                     continue;
                 }
-                
-                if (unassignedCount == 0) {
-                    return false;
+
+                // current is the root of a component. The dual component (negated literals) may already have a
+                // representative, in which case the negation of that representative is used
+                const auto componentBegin = stack.begin() + static_cast<std::ptrdiff_t>(stackPosition[current]);
+                Literal representative(current);
+                for (auto it = componentBegin; it != stack.end(); ++it) {
+                    const Literal l(*it);
+                    if (hasRepresentative[l.negate().get()]) {
+                        representative = representatives[l.negate().get()].negate();
+                        break;
+                    }
+
+                    representative = Literal(std::min(representative.get(), l.get()));
+                }
+
+                for (auto it = componentBegin; it != stack.end(); ++it) {
+                    onStack[*it] = 0;
+                    hasRepresentative[*it] = 1;
+                    representatives[*it] = representative;
                 }
-                
-                if (unassignedCount == 1) {
-                    if (!assign(unitLiteral)) {
+
+                // a literal and its negation in the same component => unsatisfiable
+                for (auto it = componentBegin; it != stack.end(); ++it) {
+                    const auto negated = Literal(*it).negate().get();
+                    if (hasRepresentative[negated] && representatives[negated] == representative) {
                         return false;
                     }
-                    changed = true;
                 }
+
+                stack.erase(componentBegin, stack.end());
             }
         }
-        
+
         return true;
     }
-} // sat
\ No newline at end of file
+
+    bool Solver::substituteEquivalences() {
+        std::vector<Literal> representatives;
+        if (!findRepresentatives(representatives)) {
+            conflicting = true;
+            return false;
+        }
+
+        std::vector<unsigned> newlySubstituted;
+        for (unsigned varId = 0; varId < numVariables; ++varId) {
+            if (!substituted[varId] && representatives[pos(varId).get()] != pos(varId)) {
+                newlySubstituted.emplace_back(varId);
+            }
+        }
+
+        if (newlySubstituted.empty()) {
+            return true;
+        }
+
+        // rebuild the clause database with substituted literals
+        struct StoredClause {
+            std::vector<Literal> literals;
+            bool learned;
+            unsigned lbd;
+            ClauseTier tier;
+        };
+
+        std::vector<StoredClause> stored;
+        for (const auto *clauseList : {&originals, &learnts}) {
+            for (ClauseRef cref : *clauseList) {
+                const auto clause = clauses[cref];
+                auto &[literals, learned, lbd, tier] = stored.emplace_back(
+                    std::vector<Literal>{}, clause.learned(), clause.lbd(), clause.tier());
+                for (Literal l : clause) {
+                    literals.emplace_back(representatives[l.get()]);
+                }
+
+                clauses.free(cref);
+            }
+        }
+
+        // representatives of earlier rounds may have been substituted themselves
+        for (unsigned varId = 0; varId < numVariables; ++varId) {
+            if (substituted[varId]) {
+                substitutes[varId] = representatives[substitutes[varId].get()];
+            }
+        }
+
+        for (unsigned varId : newlySubstituted) {
+            substituted[varId] = 1;
+            substitutes[varId] = representatives[pos(varId).get()];
+            ++stats.substitutedVariables;
+        }
+
+        originals.clear();
+        learnts.clear();
+        for (auto &watchList : watches) {
+            watchList.clear();
+        }
+
+        for (auto &watchList : binaryWatches) {
+            watchList.clear();
+        }
+
+        // level 0 assignments are never analyzed, their reasons are dropped together with the old clauses
+        for (Literal l : trail) {
+            reasons[var(l).get()] = NoReason;
+        }
+
+        for (auto &[literals, learned, lbd, tier] : stored) {
+            std::ranges::sort(literals, {}, [](Literal l) { return l.get(); });
+            literals.erase(std::unique(literals.begin(), literals.end()), literals.end());
+            bool redundant = false;
+            for (std::size_t i = 0; i < literals.size() && !redundant; ++i) {
+                redundant = satisfied(literals[i]) || (i > 0 && literals[i - 1] == literals[i].negate());
+            }
+
+            std::erase_if(literals, [this](Literal l) { return falsified(l); });
+            if (redundant) {
+                continue;
+            }
+
+            if (literals.empty()) {
+                conflicting = true;
+                return false;
+            }
+
+            if (literals.size() == 1) {
+                if (!satisfied(literals.front())) {
+                    enqueue(literals.front(), NoReason);
+                }
+
+                continue;
+            }
+
+            const ClauseRef cref = attachClause(literals, learned);
+            if (learned) {
+                clauses[cref].setLbd(lbd);
+                clauses[cref].setTier(tier);
+            }
+        }
+
+        // substituted variables occur in no clause anymore. Parking them on level 0 takes them out of branching,
+        // their actual value is taken from their representative once a model is found (see assignSubstituted)
+        for (unsigned varId : newlySubstituted) {
+            if (values[pos(varId).get()] == 0) {
+                enqueue(pos(varId), NoReason);
+            }
+        }
+
+        collectGarbage();
+        if (propagateAll() != NoReason) {
+            conflicting = true;
+        }
+
+        return !conflicting;
+    }
+
+    Literal Solver::representative(Literal l) const {
+        if (!substituted[var(l).get()]) {
+            return l;
+        }
+
+        const Literal r = substitutes[var(l).get()];
+        return l.sign() > 0 ? r : r.negate();
+    }
+
+    void Solver::assignSubstituted() {
+        for (unsigned varId = 0; varId < numVariables; ++varId) {
+            if (substituted[varId]) {
+                const Literal l = satisfied(representative(pos(varId))) ? pos(varId) : neg(varId);
+                values[l.get()] = 1;
+                values[l.negate().get()] = -1;
+                model[varId] = l.sign() > 0 ? TruthValue::True : TruthValue::False;
+            }
+        }
+    }
+
+    void Solver::purgeWatches() {
+        for (auto &watchList : watches) {
+            std::erase_if(watchList, [this](const Watch &w) { return clauses[w.cref].deleted(); });
+        }
+
+        for (auto &watchList : binaryWatches) {
+            std::erase_if(watchList, [this](const BinaryWatch &w) { return clauses[w.cref].deleted(); });
+        }
+    }
+
+    void Solver::collectGarbage() {
+        ++stats.compactions;
+        ClauseArena to;
+        to.reserve(clauses.size() - clauses.wasted());
+        // clauses are copied in the order they are first encountered => clauses watched together are stored together
+        for (auto &watchList : watches) {
+            for (auto &w : watchList) {
+                w.cref = clauses.relocate(w.cref, to);
+            }
+        }
+
+        for (auto &watchList : binaryWatches) {
+            for (auto &w : watchList) {
+                w.cref = clauses.relocate(w.cref, to);
+            }
+        }
+
+        for (Literal l : trail) {
+            auto &r = reasons[var(l).get()];
+            if (r != NoReason) {
+                r = clauses.relocate(r, to);
+            }
+        }
+
+        for (auto *clauseList : {&originals, &learnts}) {
+            for (auto &cref : *clauseList) {
+                cref = clauses.relocate(cref, to);
+            }
+        }
+
+        clauses = std::move(to);
+    }
+
+    void Solver::setHeuristic(Heuristic h) {
+        heuristic = std::move(h);
+    }
+
+    void Solver::setRestartPolicy(RestartPolicy policy) {
+        restartPolicy = std::move(policy);
+    }
+
+    void Solver::setChronoThreshold(unsigned threshold) {
+        chronoThreshold = threshold;
+    }
+
+    void Solver::setStopToken(std::stop_token token) {
+        stopToken = std::move(token);
+    }
+
+    void Solver::setMemoryLimit(std::size_t bytes) {
+        memoryLimit = bytes;
+    }
+
+    std::size_t Solver::memoryUsage() const {
+        // each clause with at least three literals has two watches, binary clauses two binary watches
+        constexpr std::size_t ClauseOverhead = sizeof(ClauseRef) + 2 * std::max(sizeof(Watch), sizeof(BinaryWatch));
+        return clauses.size() * sizeof(std::uint32_t) + (originals.size() + learnts.size()) * ClauseOverhead +
+               numVariables * VariableMemory;
+    }
+
+    void Solver::setClauseSharing(ClauseSharing hooks) {
+        sharing = std::move(hooks);
+    }
+
+    void Solver::setPhases(const std::vector<TruthValue> &phases) {
+        for (unsigned varId = 0; varId < numVariables; ++varId) {
+            if (phases[varId] != TruthValue::Undefined) {
+                savedPhases[varId] = static_cast<std::int8_t>(phases[varId]);
+                // target phases take precedence over saved phases => they must not hide the new phases
+                targetPhases[varId] = savedPhases[varId];
+            }
+        }
+
+        targetSize = 0;
+    }
+
+    std::vector<TruthValue> Solver::getPhases() const {
+        std::vector<TruthValue> phases;
+        phases.reserve(numVariables);
+        for (unsigned varId = 0; varId < numVariables; ++varId) {
+            phases.emplace_back(decisionLiteral(Variable(varId)).sign() > 0 ? TruthValue::True : TruthValue::False);
+        }
+
+        return phases;
+    }
+
+    SolveResult Solver::solve() {
+        return solve({});
+    }
+
+    SolveResult Solver::solve(const std::vector<Literal> &assumptions) {
+        core.clear();
+        if (conflicting) {
+            return SolveResult::Unsat;
+        }
+
+        backtrack(0);
+        this->assumptions = assumptions;
+
+        std::vector<Literal> learnt;
+        while (true) {
+            const ClauseRef conflict = propagateAll();
+            if (conflict != NoReason) {
+                ++stats.conflicts;
+                // with out of order assignments, the conflict may be on a lower level than the current one
+                const auto conflictLevel = maxLevel(conflict);
+                if (conflictLevel == 0) {
+                    conflicting = true;
+                    return SolveResult::Unsat;
+                }
+
+                backtrack(conflictLevel);
+                updateTargetPhases();
+                const auto backjumpLevel = analyze(conflict, learnt);
+                events.conflict.trigger(std::span<const Variable>(conflictVariables));
+                const auto lbd = computeLbd(learnt);
+                if (currentLevel() - backjumpLevel > chronoThreshold) {
+                    ++stats.chronoBacktracks;
+                    backtrack(currentLevel() - 1);
+                } else {
+                    backtrack(backjumpLevel);
+                }
+
+                learn(learnt, lbd, backjumpLevel);
+                if (stopToken.stop_requested() || memoryUsage() > memoryLimit) {
+                    return SolveResult::Unknown;
+                }
+
+                if (restartPolicy(lbd) && currentLevel() > 0) {
+                    ++stats.restarts;
+                    backtrack(0);
+                }
+
+                continue;
+            }
+
+            if (stats.conflicts >= nextReduction) {
+                reductionInterval += ReductionIncrement;
+                nextReduction = stats.conflicts + reductionInterval;
+                reduceLearnts();
+            }
+
+            if (stats.conflicts >= nextRephase) {
+                nextRephase = stats.conflicts + RephaseInterval * (rephaseCount + 2);
+                rephase();
+            }
+
+            if (currentLevel() == 0 && stats.conflicts >= nextInprocessing) {
+                nextInprocessing = stats.conflicts + InprocessingInterval;
+                if (!probe() || !substituteEquivalences()) {
+                    return SolveResult::Unsat;
+                }
+
+                continue;
+            }
+
+            if (currentLevel() == 0 && stats.conflicts >= nextSubsumption) {
+                nextSubsumption = stats.conflicts + SubsumptionInterval;
+                if (!subsumeLearnts() || !vivifyLearnts()) {
+                    return SolveResult::Unsat;
+                }
+
+                continue;
+            }
+
+            if (currentLevel() == 0 && sharing.importClause) {
+                const auto numImported = stats.importedClauses;
+                if (!importClauses()) {
+                    return SolveResult::Unsat;
+                }
+
+                if (stats.importedClauses != numImported) {
+                    continue;
+                }
+            }
+
+            if (currentLevel() < this->assumptions.size()) {
+                const Literal assumption = representative(this->assumptions[currentLevel()]);
+                if (falsified(assumption)) {
+                    analyzeFinal(this->assumptions[currentLevel()]);
+                    return SolveResult::Unsat;
+                }
+
+                // satisfied assumptions still open an (empty) level so that levels and assumptions stay aligned
+                newDecisionLevel();
+                if (!satisfied(assumption)) {
+                    enqueue(assumption, NoReason);
+                }
+
+                continue;
+            }
+
+            if (trail.size() == numVariables) {
+                assignSubstituted();
+                return SolveResult::Sat;
+            }
+
+            // long stretches without conflicts must not overrun the limits
+            if (stopToken.stop_requested() || memoryUsage() > memoryLimit) {
+                return SolveResult::Unknown;
+            }
+
+            ++stats.decisions;
+            const Variable next = heuristic(model, numVariables - trail.size());
+            newDecisionLevel();
+            enqueue(decisionLiteral(next), NoReason);
+        }
+    }
+
+    const std::vector<TruthValue> &Solver::getModel() const {
+        return model;
+    }
+
+    const Statistics &Solver::getStatistics() const {
+        return stats;
+    }
+
+    std::size_t Solver::numLearnts() const {
+        return learnts.size();
+    }
+
+    std::size_t Solver::numLearnts(ClauseTier tier) const {
+        return static_cast<std::size_t>(std::ranges::count_if(learnts, [this, tier](ClauseRef cref) {
+            return clauses[cref].tier() == tier;
+        }));
+    }
+
+    const std::vector<Literal> &Solver::getCore() const {
+        return core;
+    }
+
+    SearchEvents &Solver::getEvents() {
+        return events;
+    }
+} // sat
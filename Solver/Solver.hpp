@@ -8,43 +8,429 @@
 #ifndef SOLVER_HPP
 #define SOLVER_HPP
 
-#include <memory>
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <stop_token>
+#include <functional>
+#include <span>
 
 #include "basic_structures.hpp"
 #include "Clause.hpp"
+#include "ClauseArena.hpp"
+#include "heuristics.hpp"
+#include "restart.hpp"
+#include "util/enum.hpp"
 
 namespace sat {
-    /*
-     * These two types might be useful for your implementation. A shared pointer manages an object on the heap. It can
-     * be copied without copying the actual object. This can be useful if you want to access the same clause from
-     * multiple locations without copying it. Once all copies of the pointer have been destroyed, the actual object
-     * is also destroyed
+    /**
+     * @brief Result of a call to Solver::solve. Unknown if the search was stopped before an answer was found
+     */
+    PENUM(SolveResult, Sat, Unsat, Unknown)
+
+    /**
+     * @brief Search statistics of a solver
      */
-    using ClausePointer = std::shared_ptr<Clause>;
-    using ConstClausePointer = std::shared_ptr<const Clause>;
+    struct Statistics {
+        std::size_t decisions = 0; ///< number of branching decisions
+        std::size_t conflicts = 0; ///< number of conflicts encountered during search
+        std::size_t propagations = 0; ///< number of literals whose negation was visited by unit propagation
+        std::size_t learnedClauses = 0; ///< number of learned clauses (including learned units)
+        std::size_t minimizedLiterals = 0; ///< number of literals removed from learned clauses by minimization
+        std::size_t reductions = 0; ///< number of learned clause database reductions
+        std::size_t deletedClauses = 0; ///< number of learned clauses deleted by reductions
+        std::size_t compactions = 0; ///< number of clause arena compactions
+        std::size_t restarts = 0; ///< number of restarts
+        std::size_t chronoBacktracks = 0; ///< number of conflicts after which only one level was backtracked
+        std::size_t rephases = 0; ///< number of times the saved phases were reset
+        std::size_t subsumedClauses = 0; ///< number of learned clauses removed by subsumption
+        std::size_t strengthenedClauses = 0; ///< number of learned clauses strengthened by self-subsuming resolution
+        std::size_t failedLiterals = 0; ///< number of units found by failed literal probing
+        std::size_t substitutedVariables = 0; ///< number of variables replaced by an equivalent literal
+        std::size_t vivifiedClauses = 0; ///< number of learned clauses shortened by vivification
+        std::size_t vivifiedLiterals = 0; ///< number of literals removed by vivification
+        std::size_t exportedClauses = 0; ///< number of learned clauses passed on to other solvers
+        std::size_t importedClauses = 0; ///< number of clauses received from other solvers
+        std::size_t usefulImports = 0; ///< number of imported clauses that took part in conflict analysis
+    };
 
+    /**
+     * @brief Hooks through which a solver exchanges learned clauses with other solvers. Empty hooks are not called
+     */
+    struct ClauseSharing {
+        /// called with every learned clause and its LBD. Returns whether the clause was exported
+        std::function<bool(std::span<const Literal>, unsigned)> exportClause;
+        /// called on level 0 until it returns false. Fills in the next clause of another solver and its LBD
+        std::function<bool(std::vector<Literal> &, unsigned &)> importClause;
+    };
 
     /**
      * @brief Main solver class
      */
     class Solver {
-        // @TODO private members here
+        /**
+         * @brief Entry of a binary implication list. The clause is stored for conflict analysis only
+         */
+        struct BinaryWatch {
+            Literal implied; ///< the other literal of the binary clause
+            ClauseRef cref; ///< the binary clause
+        };
+
+        /**
+         * @brief Entry of a watch list of long clauses
+         */
+        struct Watch {
+            ClauseRef cref; ///< the watching clause
+            Literal blocker; ///< some other literal of the clause. If it is satisfied, the clause need not be visited
+        };
+
+        /**
+         * @brief Scope of an inprocessing technique that makes trial assignments on level 0 (probing, vivification).
+         * @details Trial assignments are not search: the saved phases are restored when the scope ends and
+         * propagations are counted by the scope instead of the search statistics
+         */
+        class TrialScope {
+            Solver &solver;
+            std::vector<std::int8_t> phases;
+        public:
+            std::size_t propagations = 0; ///< number of literals visited by propagate within this scope
+
+            explicit TrialScope(Solver &solver);
+            ~TrialScope();
+            TrialScope(const TrialScope &) = delete;
+            TrialScope &operator=(const TrialScope &) = delete;
+
+            /**
+             * Propagates all pending literals on the trail (see Solver::propagateAll)
+             * @return a clause that is falsified under the current model, NoReason if there is none
+             */
+            ClauseRef propagate();
+        };
+
         unsigned numVariables;
-        std::vector<TruthValue> model;
-        std::vector<Literal> literals;
-        std::vector<std::shared_ptr<Clause>> clauses;
+        std::vector<TruthValue> model; ///< per variable: truth value, passed to the heuristic
+        std::vector<std::int8_t> values; ///< per literal: 1 if satisfied, -1 if falsified, 0 if unassigned
+        ClauseArena clauses;
+        std::vector<ClauseRef> originals; ///< problem clauses with at least two literals
+        std::vector<ClauseRef> learnts; ///< learned clauses with at least two literals
+        std::vector<std::vector<Watch>> watches; ///< per literal: clauses (>= 3 literals) watching the literal
+        std::vector<std::vector<BinaryWatch>> binaryWatches; ///< per literal: literals implied when it becomes false
+        std::vector<Literal> trail; ///< assigned literals in assignment order
+        std::vector<std::size_t> trailLimits; ///< per decision level: position in the trail where the level starts
+        std::vector<unsigned> levels; ///< per variable: decision level of the assignment
+        std::vector<Literal> outOfOrder; ///< literals of lower levels that are kept on the trail during backtracking
+        std::vector<ClauseRef> reasons; ///< per variable: clause that implied the assignment
+        std::size_t queueHead = 0; ///< position of the next literal in the trail whose negation must be visited
+        std::size_t binaryQueueHead = 0; ///< same as queueHead but for the binary implication lists
+        std::vector<char> seen; ///< per variable: marker used during conflict analysis (see Source, Removable, Poison)
+        std::vector<unsigned> minimizationMarked; ///< variables marked during learned clause minimization
+        /// explicit dfs stack of learned clause minimization: variable and position of the next literal in its reason
+        std::vector<std::pair<unsigned, std::uint32_t>> minimizationStack;
+        SearchEvents events;
+        std::vector<Variable> conflictVariables; ///< variables seen during the last conflict analysis
+        Heuristic heuristic;
+        RestartPolicy restartPolicy;
+        /// backjumps over more than this number of levels are replaced by chronological backtracking
+        unsigned chronoThreshold = std::numeric_limits<unsigned>::max();
+        bool conflicting = false; ///< whether the clauses are known to be unsatisfiable
+        /// checked after every conflict, before every decision and during inprocessing. solve returns once stop is
+        /// requested
+        std::stop_token stopToken;
+        /// checked after every conflict and before every decision, solve returns once the estimated memory usage
+        /// exceeds this number of bytes
+        std::size_t memoryLimit = std::numeric_limits<std::size_t>::max();
+        ClauseSharing sharing;
+        std::vector<Literal> assumptions; ///< assumptions of the current call to solve
+        std::vector<Literal> core; ///< failed assumptions of the last call to solve
+        Statistics stats;
+        std::vector<unsigned> levelStamps; ///< per decision level: stamp used to count distinct levels
+        unsigned currentStamp = 0;
+        std::size_t nextReduction; ///< number of conflicts at which the learned clauses are reduced next
+        std::size_t reductionInterval;
+        std::vector<std::int8_t> savedPhases; ///< per variable: polarity of the last assignment (1 true, -1 false)
+        /// per variable: polarity on the longest conflict free trail since the last rephase (0 if not on that trail)
+        std::vector<std::int8_t> targetPhases;
+        std::vector<std::int8_t> bestPhases; ///< per variable: polarity on the longest conflict free trail overall
+        std::size_t targetSize = 0; ///< number of assignments of the target trail
+        std::size_t bestSize = 0; ///< number of assignments of the best trail
+        std::size_t nextRephase; ///< number of conflicts at which the phases are reset next
+        std::size_t rephaseCount = 0;
+        std::size_t nextSubsumption; ///< number of conflicts after which learned clauses are subsumed next
+        std::size_t nextInprocessing = 0; ///< number of conflicts after which probing and substitution run next
+        std::vector<char> substituted; ///< per variable: whether the variable was replaced by an equivalent literal
+        std::vector<Literal> substitutes; ///< per substituted variable: the literal equivalent to its positive literal
+
+        static constexpr char Source = 1; ///< seen mark: variable is contained in the learned clause
+        static constexpr char Removable = 2; ///< seen mark: variable is implied by literals of the learned clause
+        static constexpr char Poison = 3; ///< seen mark: variable is not implied by literals of the learned clause
+        static constexpr unsigned CoreMaxLbd = 2;
+        static constexpr unsigned MidMaxLbd = 6;
+        static constexpr std::size_t FirstReduction = 2000;
+        static constexpr std::size_t ReductionIncrement = 300;
+        /// the arena is compacted once this fraction of it is occupied by deleted clauses
+        static constexpr double MaxWastedFraction = 0.2;
+        static constexpr std::size_t RephaseInterval = 1000;
+        static constexpr std::size_t SubsumptionInterval = 5000;
+        static constexpr std::size_t InprocessingInterval = 10000;
+        /// maximum number of propagated literals per probing round
+        static constexpr std::size_t ProbingBudget = 200000;
+        /// maximum number of propagated literals per vivification round
+        static constexpr std::size_t VivificationBudget = 30000;
+        /// estimated bytes of the per variable and per literal arrays of a single variable (see memoryUsage)
+        static constexpr std::size_t VariableMemory = 128;
+
+        /**
+         * Stores the given clause and registers its watchers
+         * @param literals literals of the clause (at least two). The first two literals are watched
+         * @param learned whether the clause was learned during search
+         * @return reference to the stored clause
+         */
+        ClauseRef attachClause(const std::vector<Literal> &literals, bool learned);
+
+        /**
+         * Registers the clause in the watch list of the given literal
+         * @param l watch literal
+         * @param cref the clause
+         * @param blocker another literal of the clause
+         */
+        void watch(Literal l, ClauseRef cref, Literal blocker);
+
+        /**
+         * Assigns the given literal at the current decision level and pushes it on the trail
+         * @param l Literal to assign (must be unassigned)
+         * @param reason clause that implies l or NoReason
+         */
+        void enqueue(Literal l, ClauseRef reason);
+
+        /**
+         * Assigns the given literal at the given decision level and pushes it on the trail. If the level is lower than
+         * the current decision level, the literal is assigned out of order and survives backtracking to its level
+         * @param l Literal to assign (must be unassigned)
+         * @param reason clause that implies l or NoReason
+         * @param level decision level of the assignment (at most the current decision level)
+         */
+        void enqueue(Literal l, ClauseRef reason, unsigned level);
+
+        /**
+         * Highest decision level among the literals of a clause
+         * @param cref clause whose literals are all assigned
+         * @return maximum decision level
+         */
+        unsigned maxLevel(ClauseRef cref) const;
+
+        /**
+         * Assigns all literals that are implied by binary clauses after the given literal became false. Does not
+         * access the clause arena unless a conflict occurs
+         * @param falseLit literal that just became false
+         * @return a binary clause that is falsified under the current model, NoReason if there is none
+         */
+        ClauseRef propagateBinary(Literal falseLit);
+
+        /**
+         * Visits all long clauses watching the given literal after it became false. Moves watchers where possible and
+         * assigns unit literals at the highest level of the other literals of their clause. Watch literals are kept at
+         * the first two positions of each clause. Clauses whose blocker literal is satisfied are skipped without
+         * accessing the clause arena.
+         * @param falseLit literal that just became false
+         * @return a clause that is falsified under the current model, NoReason if there is none
+         */
+        ClauseRef propagate(Literal falseLit);
+
+        /**
+         * Propagates all pending literals on the trail. Binary implications of all pending literals are propagated
+         * before any long clause is visited
+         * @return a clause that is falsified under the current model, NoReason if there is none
+         */
+        ClauseRef propagateAll();
+
+        /**
+         * @copydoc propagateAll()
+         * @param propagations counter of visited literals to increment instead of the search statistics
+         */
+        ClauseRef propagateAll(std::size_t &propagations);
+
+        /**
+         * Derives the first unique implication point (1-UIP) clause from the given conflict and minimizes it. The
+         * current decision level must be the highest level of the conflict clause
+         * @param conflict the falsified clause
+         * @param learnt output: learned clause. The asserting literal is at position 0, a literal of the backjump
+         * level is at position 1
+         * @return decision level to backjump to
+         */
+        unsigned analyze(ClauseRef conflict, std::vector<Literal> &learnt);
+
+        /**
+         * Removes literals from a learned clause that are implied by other literals of the clause. The reasons of a
+         * literal are followed recursively. The outcome is cached per variable as Removable or Poison mark, so that
+         * each variable is visited at most once per conflict
+         * @param learnt learned clause as computed by analyze. Literals except the first must be marked as Source
+         */
+        void minimize(std::vector<Literal> &learnt);
+
+        /**
+         * Checks whether a literal of the learned clause is implied by the other literals of the clause
+         * @param l literal of the learned clause with a reason
+         * @param levelMask abstraction of the decision levels in the learned clause. Literals of other levels cannot
+         * be implied by the clause
+         * @return true if the literal can be removed, false otherwise
+         */
+        bool isRedundant(Literal l, std::uint32_t levelMask);
+
+        /**
+         * Adds the clause learned from a conflict and assigns its asserting literal. Needs to be called after
+         * backjumping
+         * @param learnt learned clause as returned by analyze
+         * @param lbd literal block distance of the clause
+         * @param level level at which the asserting literal is assigned (the backjump level returned by analyze)
+         */
+        void learn(const std::vector<Literal> &learnt, unsigned lbd, unsigned level);
+
+        /**
+         * Computes the literal block distance (number of distinct decision levels) of assigned literals
+         * @tparam Literals range of literals
+         * @param literals assigned literals
+         * @return literal block distance
+         */
+        template<typename Literals>
+        unsigned computeLbd(const Literals &literals);
+
+        /**
+         * Retention tier of a learned clause with the given LBD
+         * @param lbd literal block distance
+         * @return clause tier
+         */
+        static ClauseTier tierFor(unsigned lbd) noexcept;
+
+        /**
+         * Marks a learned clause that took part in conflict analysis as used and updates its LBD. Clauses whose LBD
+         * improved are promoted to a better tier. Imported clauses are counted as useful
+         * @param cref learned clause
+         */
+        void bumpClause(ClauseRef cref);
+
+        /**
+         * Whether the given clause is currently the reason of an assignment and must therefore not be deleted
+         * @param cref the clause
+         * @return true if clause is reason for one of its two watched literals
+         */
+        bool isLocked(ClauseRef cref) const;
+
+        /**
+         * Computes the assumptions responsible for falsifying the given assumption and stores them in core
+         * @param failed assumption that is falsified by the current assignment
+         */
+        void analyzeFinal(Literal failed);
+
+        /**
+         * Records the polarities of the conflict free part of the trail as target and best phases if it is longer
+         * than the respective trails seen so far. Needs to be called on conflict before backjumping
+         */
+        void updateTargetPhases();
+
+        /**
+         * Polarity in which a decision variable is assigned. The target phase is preferred over the saved phase
+         * @param x decision variable
+         * @return decision literal
+         */
+        Literal decisionLiteral(Variable x) const;
+
+        /**
+         * Deletes learned clauses of low value. Core clauses are kept. Mid tier clauses are kept if they were used
+         * since the last reduction and are demoted otherwise. Among the unused local clauses, the half with the highest
+         * LBD is deleted. Compacts the clause arena if enough memory is wasted.
+         */
+        void reduceLearnts();
+
+        /**
+         * Removes learned clauses that are subsumed by other learned clauses and strengthens learned clauses by
+         * self-subsuming resolution. Candidate pairs are filtered by their signatures. Clauses strengthened to units
+         * are assigned and propagated. Must be called on level 0
+         * @return false if the clauses were found unsatisfiable, true otherwise
+         */
+        bool subsumeLearnts();
+
+        /**
+         * Vivification of core and mid tier learned clauses, starting with the lowest LBD. The negations of the
+         * literals of a clause are assigned one at a time and propagated without the clause itself. Falsified literals
+         * are redundant and dropped. If a literal becomes satisfied or propagation leads to a conflict, the remaining
+         * literals are dropped. Pending literals of level 0 are propagated first. Must be called on level 0
+         * @return false if the clauses were found unsatisfiable, true otherwise
+         */
+        bool vivifyLearnts();
+
+        /**
+         * Adds all clauses provided by the import hook as learned clauses. Must be called on level 0
+         * @return false if the clauses were found unsatisfiable, true otherwise
+         */
+        bool importClauses();
+
+        /**
+         * Failed literal probing. Literals that imply other literals through binary clauses are assigned one at a
+         * time and propagated. If this leads to a conflict, the negation of the probe is a unit. Must be called on
+         * level 0
+         * @return false if the clauses were found unsatisfiable, true otherwise
+         */
+        bool probe();
+
+        /**
+         * Equivalent literal substitution. Computes the strongly connected components of the binary implication
+         * graph (Tarjan). All literals of a component are equivalent and are replaced by a single representative in
+         * all clauses. Replaced variables occur in no clause afterwards and are no decision variables anymore. They
+         * are parked on level 0 and get the value of their representative once a model is found. Clauses, imported
+         * clauses and assumptions that contain replaced variables are mapped to the representatives. Returns right
+         * away if no new equivalence is found. Must be called on level 0
+         * @return false if the clauses were found unsatisfiable, true otherwise
+         */
+        bool substituteEquivalences();
+
+        /**
+         * Maps a literal to its representative
+         * @param l the literal
+         * @return equivalent literal of the representative if the variable of l was substituted, l otherwise
+         */
+        Literal representative(Literal l) const;
+
+        /**
+         * Assigns every substituted variable the value of its representative. Called when a model is found
+         */
+        void assignSubstituted();
+
+        /**
+         * Computes the representative of every literal from the strongly connected components of the binary
+         * implication graph of the unassigned literals
+         * @param representatives per literal: output representative literal (the literal itself if not equivalent
+         * to another literal)
+         * @return false if a variable is equivalent to its own negation, true otherwise
+         */
+        bool findRepresentatives(std::vector<Literal> &representatives) const;
+
+        /**
+         * Removes watch list entries of deleted clauses
+         */
+        void purgeWatches();
+
+        /**
+         * Moves all live clauses into a fresh arena, releasing the memory of deleted clauses. All clause references
+         * held by the solver are relocated.
+         */
+        void collectGarbage();
     public:
+        /// Reason of assignments that were not implied by a clause (decisions and facts)
+        static constexpr ClauseRef NoReason = NoClause;
 
         /**
-         * Ctor. Allocates enough space for the variables.
+         * Ctor. Allocates enough space for the variables. Uses the EVSIDS branching heuristic
          * @param numVariables Number of variables in the problem
          * @note This Ctor needs to exist for the tests. You can add other Ctors if you want
          */
         explicit Solver(unsigned numVariables);
 
-        /*
-         * @TODO if you want, you can declare additional constructors here
+        /**
+         * Ctor.
+         * @param numVariables Number of variables in the problem
+         * @param heuristic branching heuristic used by solve
          */
+        Solver(unsigned numVariables, Heuristic heuristic);
 
 
         /*
@@ -53,7 +439,8 @@ namespace sat {
          */
 
         /**
-         * Adds a clause to the solver.
+         * Adds a clause to the solver. Can also be called between calls to solve. In that case the solver first
+         * backtracks to level 0 (which discards the model of the previous call)
          * @param clause The clause to add
          * @return bool true if clause was successfully added, false if clause is empty or unit and violates the current
          * model
@@ -67,7 +454,8 @@ namespace sat {
         auto rebase() const -> std::vector<Clause>;
 
         /**
-         * Returns the truth value of the given variable
+         * Returns the truth value of the given variable. Variables replaced by equivalent literal substitution only
+         * have a meaningful value after solve returned SolveResult::Sat
          * @param x a variable (needs to be contained in the solver)
          * @return TruthValue of the given variable
          */
@@ -88,14 +476,187 @@ namespace sat {
         bool falsified(Literal l) const;
 
         /**
-         * Assigns the given literal
+         * Assigns the given literal at the current decision level
          * @param l Literal to assign
          * @return false if literal is already falsified, true otherwise
          */
         bool assign(Literal l);
 
         /**
-         * Does the unit propagation.
+         * Gets the decision level at which the given variable was assigned
+         * @param x a variable (needs to be assigned)
+         * @return decision level of x
+         */
+        unsigned level(Variable x) const;
+
+        /**
+         * Gets the clause that implied the assignment of the given variable
+         * @param x a variable (needs to be assigned)
+         * @return clause reference or NoReason if x was decided or assigned directly
+         */
+        ClauseRef reason(Variable x) const;
+
+        /**
+         * Gets the current decision level. Level 0 contains all assignments that hold independently of any decision
+         * @return current decision level
+         */
+        unsigned currentLevel() const;
+
+        /**
+         * Gets the number of assigned variables
+         * @return number of literals on the trail
+         */
+        std::size_t numAssignments() const;
+
+        /**
+         * Opens a new decision level. Subsequent assignments belong to this level
+         */
+        void newDecisionLevel();
+
+        /**
+         * Undoes all assignments above the given decision level. Literals that were assigned out of order at or below
+         * the given level are kept on the trail. Runs in time proportional to the number of literals above the level
+         * @param level target decision level. Does nothing if level >= currentLevel()
+         */
+        void backtrack(unsigned level);
+
+        /**
+         * Replaces the branching heuristic used by solve
+         * @param h new heuristic (needs to be valid)
+         */
+        void setHeuristic(Heuristic h);
+
+        /**
+         * Replaces the restart policy used by solve. By default, glucose style restarts are used
+         * @param policy new restart policy (needs to be valid)
+         */
+        void setRestartPolicy(RestartPolicy policy);
+
+        /**
+         * Enables chronological backtracking. If a conflict would backjump over more than the given number of decision
+         * levels, the solver backtracks only one level and assigns the asserting literal out of order. By default,
+         * the solver always backjumps non-chronologically
+         * @param threshold maximum number of levels to jump over non-chronologically
+         */
+        void setChronoThreshold(unsigned threshold);
+
+        /**
+         * Sets the stop token through which a running call to solve can be cancelled, e.g. from another thread. The
+         * token is checked after every conflict, before every decision and by the inprocessing techniques
+         * @param token stop token. By default, the solver cannot be stopped
+         */
+        void setStopToken(std::stop_token token);
+
+        /**
+         * Sets the memory limit of the search. The limit is checked after every conflict and before every decision
+         * against memoryUsage
+         * @param bytes maximum estimated memory usage in bytes. By default, the memory is not limited
+         */
+        void setMemoryLimit(std::size_t bytes);
+
+        /**
+         * Estimates the memory used by the solver. Counts the clause arena, the clause lists and watches and a fixed
+         * amount per variable. Runs in constant time
+         * @return estimated memory usage in bytes
+         */
+        std::size_t memoryUsage() const;
+
+        /**
+         * Sets the hooks through which learned clauses are exchanged with other solvers. Learned clauses are exported
+         * as soon as they are learned. Clauses of other solvers are imported whenever the search is on level 0, e.g.
+         * after a restart
+         * @param hooks clause sharing hooks
+         */
+        void setClauseSharing(ClauseSharing hooks);
+
+        /**
+         * Overwrites the saved phases, i.e. the polarities in which decision variables are assigned. The target phases
+         * are overwritten as well and the target trail is reset, so the phases also apply to a solver that already
+         * searched
+         * @param phases per variable: preferred truth value. Undefined entries leave the saved phase unchanged
+         */
+        void setPhases(const std::vector<TruthValue> &phases);
+
+        /**
+         * Gets the polarities in which decision variables are assigned, i.e. the target phase if there is one and the
+         * saved phase otherwise
+         * @return per variable: preferred truth value
+         */
+        std::vector<TruthValue> getPhases() const;
+
+        /**
+         * Overwrites the saved phases. Cycles through original (all false), best, inverted (all true), best and
+         * random phases. The target phases are reset to the new saved phases. Called periodically during search
+         */
+        void rephase();
+
+        /**
+         * Searches for a model of the clauses using conflict driven clause learning (CDCL). Branching variables are
+         * picked by the heuristic and are assigned their target or saved phase (initially false). Each conflict yields
+         * a 1-UIP clause after which the solver backjumps to the asserting level. After each conflict, the restart
+         * policy decides whether to backtrack to level 0. The phases are periodically reset (see rephase).
+         * @return SolveResult::Sat if a model was found (see getModel), SolveResult::Unsat if there is none,
+         * SolveResult::Unknown if the search was stopped (see setStopToken) or ran out of memory (see setMemoryLimit)
+         */
+        SolveResult solve();
+
+        /**
+         * Searches for a model of the clauses in which all assumptions hold. The assumptions are assigned as
+         * pseudo-decisions on the first decision levels. Learned clauses do not depend on the assumptions and are kept
+         * for subsequent calls.
+         * @param assumptions literals that must be satisfied
+         * @return SolveResult::Sat if a model was found (see getModel), SolveResult::Unsat if there is no model under
+         * the given assumptions (see getCore), SolveResult::Unknown if the search was stopped (see setStopToken) or
+         * ran out of memory (see setMemoryLimit)
+         */
+        SolveResult solve(const std::vector<Literal> &assumptions);
+
+        /**
+         * Gets the failed assumptions after solve returned SolveResult::Unsat. The clauses together with the returned
+         * assumptions are unsatisfiable. If the returned vector is empty, the clauses are unsatisfiable without any
+         * assumptions
+         * @return subset of the assumptions of the last call to solve
+         */
+        const std::vector<Literal> &getCore() const;
+
+        /**
+         * Gets the current assignment of all variables. After solve returned SolveResult::Sat, this is a model of
+         * the clauses
+         * @return truth value per variable
+         */
+        const std::vector<TruthValue> &getModel() const;
+
+        /**
+         * Gets the search statistics
+         * @return statistics accumulated over all calls to solve
+         */
+        const Statistics &getStatistics() const;
+
+        /**
+         * Gets the number of learned clauses with at least two literals currently kept by the solver
+         * @return size of the learned clause database
+         */
+        std::size_t numLearnts() const;
+
+        /**
+         * Gets the number of learned clauses with at least two literals in the given tier
+         * @param tier tier of the clauses to count
+         * @return number of learned clauses in that tier
+         */
+        std::size_t numLearnts(ClauseTier tier) const;
+
+        /**
+         * Access to the search events. Stateful heuristics subscribe to them, e.g.
+         * @code
+         * solver.setHeuristic(MovableHeuristic<EVSIDS>(numVariables, solver.getEvents()));
+         * @endcode
+         * @return events triggered during search
+         */
+        SearchEvents &getEvents();
+
+        /**
+         * Does the unit propagation. Only the clauses watching a literal that became false since the last call are
+         * visited.
          * @return true if unit propagation was successful, false otherwise
          */
         bool unitPropagate();
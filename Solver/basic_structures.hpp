@@ -8,8 +8,8 @@
 #ifndef BASIC_STRUCTURES_HPP
 #define BASIC_STRUCTURES_HPP
 
-/* These are only the declarations of the classes and their members
- * @TODO implementation in basic_structures.cpp
+/* All members are defined inline. Literals are accessed in the innermost loops of the solver and must not incur a
+ * function call
  */
 
 namespace sat {
@@ -34,19 +34,23 @@ namespace sat {
          * CTor
          * @param val variable number (name of the variable)
          */
-        Variable(unsigned val);
+        constexpr Variable(unsigned val) noexcept: value(val) {}
 
         /**
          * gets the underlying variable number
          * @return
          */
-        unsigned get() const;
+        constexpr unsigned get() const noexcept {
+            return value;
+        }
 
         /**
          * Compares the underlying variable identifier
          * @return True if both variables are the same (have the same identifier)
          */
-        bool operator==(Variable other) const;
+        constexpr bool operator==(Variable other) const noexcept {
+            return value == other.value;
+        }
     };
 
     /**
@@ -64,30 +68,38 @@ namespace sat {
          * identifier stands for a negative literal, an odd one for a positive
          * see also sat::pos and sat::neg
          */
-        Literal(unsigned val);
+        constexpr Literal(unsigned val) noexcept: literal(val) {}
         /**
          * Gets the underlying literal identifier
          * @return the literal identifier
          */
-        unsigned get() const;
+        constexpr unsigned get() const noexcept {
+            return literal;
+        }
 
         /**
          * Gets the negated literal
          * @return the negated literal
          */
-        Literal negate() const;
+        constexpr Literal negate() const noexcept {
+            return literal ^ 1u;
+        }
 
         /**
          * Gets the sign of the literal
          * @return -1 if negative literal, +1 else
          */
-        short sign() const;
+        constexpr short sign() const noexcept {
+            return static_cast<short>(2 * static_cast<int>(literal & 1u) - 1);
+        }
 
         /**
          * Compares underlying literal identifiers
          * @return True if both literals are exactly the same (sign and variable)
          */
-        bool operator==(Literal) const;
+        constexpr bool operator==(Literal other) const noexcept {
+            return literal == other.literal;
+        }
     };
 
     /**
@@ -95,21 +107,27 @@ namespace sat {
      * @param x Variable for which to create the literal
      * @return positive literal of x
      */
-    Literal pos(Variable x);
+    constexpr Literal pos(Variable x) noexcept {
+        return x.get() * 2 + 1;
+    }
 
     /**
      * Creates the negative Literal for a given variable
      * @param x Variable for which to create the literal
      * @return negative literal of x
      */
-    Literal neg(Variable x);
+    constexpr Literal neg(Variable x) noexcept {
+        return x.get() * 2;
+    }
 
     /**
      * Gets the corresponding Variable of a Literal
      * @param l
      * @return Variable of given Literal
      */
-    Variable var(Literal l);
+    constexpr Variable var(Literal l) noexcept {
+        return l.get() / 2;
+    }
 
 }
 
@@ -5,6 +5,7 @@
 */
 
 #include <Iterators.hpp>
+#include <algorithm>
 
 #include "heuristics.hpp"
 #include "util/exception.hpp"
@@ -21,6 +22,127 @@ namespace sat {
         throw std::runtime_error("Found no open variable");
     }
 
+    EVSIDS::EVSIDS(unsigned numVariables, SearchEvents &events, double decay)
+        : activity(numVariables, 0), heap(numVariables, ActivityLess{&activity}), decay(decay) {
+        for (unsigned varId = 0; varId < numVariables; ++varId) {
+            heap.insert(varId);
+        }
+
+        unassignHandle = events.unassign.subscribe_handled([this](Variable x) { heap.insert(x.get()); });
+        conflictHandle = events.conflict.subscribe_handled([this](std::span<const Variable> variables) {
+            for (Variable x : variables) {
+                bump(x);
+            }
+
+            increment /= this->decay;
+        });
+    }
+
+    void EVSIDS::bump(Variable x) {
+        constexpr double Limit = 1e100;
+        if ((activity[x.get()] += increment) > Limit) {
+            for (auto &a : activity) {
+                a /= Limit;
+            }
+
+            increment /= Limit;
+        }
+
+        heap.increased(x.get());
+    }
+
+    Variable EVSIDS::operator()(const std::vector<TruthValue> &model, std::size_t) {
+        // assigned variables are only removed lazily
+        while (!heap.empty()) {
+            const auto varId = heap.pop();
+            if (model[varId] == TruthValue::Undefined) {
+                return Variable(varId);
+            }
+        }
+
+        throw std::runtime_error("Found no open variable");
+    }
+
+    double EVSIDS::getActivity(Variable x) const {
+        return activity[x.get()];
+    }
+
+    VMTF::VMTF(unsigned numVariables, SearchEvents &events)
+        : prev(numVariables, None), next(numVariables, None), stamps(numVariables, 0) {
+        for (unsigned varId = 0; varId < numVariables; ++varId) {
+            moveToFront(varId);
+        }
+
+        search = last;
+        unassignHandle = events.unassign.subscribe_handled([this](Variable x) {
+            if (stamps[x.get()] > stamps[search]) {
+                search = x.get();
+            }
+        });
+
+        conflictHandle = events.conflict.subscribe_handled([this](std::span<const Variable> variables) {
+            // bump in the order of the previous stamps in order to preserve the relative order of bumped variables
+            bumped.assign(variables.begin(), variables.end());
+            std::ranges::sort(bumped, [this](Variable a, Variable b) { return stamps[a.get()] < stamps[b.get()]; });
+            for (Variable x : bumped) {
+                moveToFront(x.get());
+            }
+        });
+    }
+
+    void VMTF::moveToFront(unsigned varId) {
+        if (varId == last) {
+            stamps[varId] = ++time;
+            return;
+        }
+
+        if (prev[varId] != None) {
+            next[prev[varId]] = next[varId];
+        } else if (varId == first) {
+            first = next[varId];
+        }
+
+        if (next[varId] != None) {
+            prev[next[varId]] = prev[varId];
+        }
+
+        prev[varId] = last;
+        next[varId] = None;
+        if (last != None) {
+            next[last] = varId;
+        } else {
+            first = varId;
+        }
+
+        last = varId;
+        stamps[varId] = ++time;
+    }
+
+    Variable VMTF::operator()(const std::vector<TruthValue> &model, std::size_t) {
+        while (search != None && model[search] != TruthValue::Undefined) {
+            search = prev[search];
+        }
+
+        if (search == None) {
+            throw std::runtime_error("Found no open variable");
+        }
+
+        return Variable(search);
+    }
+
+    Heuristic makeHeuristic(BranchingStrategy strategy, unsigned numVariables, SearchEvents &events) {
+        switch (strategy) {
+            case BranchingStrategy::EVSIDS:
+                return MovableHeuristic<EVSIDS>(numVariables, events);
+            case BranchingStrategy::VMTF:
+                return MovableHeuristic<VMTF>(numVariables, events);
+            case BranchingStrategy::FirstVariable:
+                return FirstVariable{};
+        }
+
+        throw std::invalid_argument("unknown branching strategy");
+    }
+
     Variable Heuristic::operator()(const std::vector<TruthValue> &values, std::size_t numOpenVariables) const {
         if (nullptr == impl) {
             throw BadHeuristicCall("heuristic wrapper does not contain a heuristic");
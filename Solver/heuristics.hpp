@@ -10,9 +10,14 @@
 
 #include <vector>
 #include <memory>
+#include <span>
+#include <cstdint>
 
 #include "basic_structures.hpp"
 #include "util/concepts.hpp"
+#include "util/SubscribableEvent.hpp"
+#include "util/IndexedHeap.hpp"
+#include "util/enum.hpp"
 
 namespace sat {
     /**
@@ -23,6 +28,17 @@ namespace sat {
     template<typename H>
     concept heuristic = concepts::callable_r<H, Variable, const std::vector<TruthValue>, std::size_t>;
 
+    /**
+     * @brief Events triggered by the solver during search. Stateful heuristics subscribe to these events instead of
+     * inspecting the whole model at every decision
+     */
+    struct SearchEvents {
+        SubscribableEvent<Variable> assign; ///< triggered when a variable is assigned
+        SubscribableEvent<Variable> unassign; ///< triggered for every variable unassigned during backtracking
+        /// triggered once per conflict with all variables that took part in conflict analysis
+        SubscribableEvent<std::span<const Variable>> conflict;
+    };
+
     /**
      * @brief Variable selection strategy that selects the first unassigned variable
      */
@@ -30,6 +46,97 @@ namespace sat {
         Variable operator()(const std::vector<TruthValue> &model, std::size_t) const;
     };
 
+    /**
+     * @brief Exponential variable state independent decaying sum (EVSIDS) heuristic.
+     * @details @copybrief
+     * Selects the unassigned variable with the highest activity. The activity of a variable is increased every time it
+     * takes part in conflict analysis. Instead of decaying all activities after each conflict, the increment grows
+     * geometrically. Unassigned variables are kept in a binary heap, so that decisions take O(log n) instead of a scan
+     * over the model.
+     * @note This heuristic subscribes to SearchEvents and can neither be copied nor moved. Wrap it in a
+     * MovableHeuristic before passing it to the solver
+     */
+    class EVSIDS {
+        struct ActivityLess {
+            const std::vector<double> *activity;
+
+            bool operator()(unsigned a, unsigned b) const noexcept {
+                return (*activity)[a] < (*activity)[b];
+            }
+        };
+
+        std::vector<double> activity;
+        IndexedHeap<ActivityLess> heap;
+        double increment = 1;
+        double decay;
+        SubscriberHandle unassignHandle;
+        SubscriberHandle conflictHandle;
+
+        void bump(Variable x);
+
+    public:
+        /**
+         * Ctor
+         * @param numVariables number of variables in the problem
+         * @param events events of the solver that uses the heuristic
+         * @param decay activity decay factor in (0, 1). Smaller values focus more on recent conflicts
+         */
+        EVSIDS(unsigned numVariables, SearchEvents &events, double decay = 0.95);
+
+        EVSIDS(const EVSIDS &) = delete;
+
+        EVSIDS &operator=(const EVSIDS &) = delete;
+
+        Variable operator()(const std::vector<TruthValue> &model, std::size_t);
+
+        /**
+         * Activity of a variable
+         * @param x the variable
+         * @return current activity (relative to the other variables)
+         */
+        double getActivity(Variable x) const;
+    };
+
+    /**
+     * @brief Variable move to front (VMTF) heuristic.
+     * @details @copybrief
+     * Variables are kept in a doubly linked queue ordered by the time they were last bumped. Variables that take part
+     * in conflict analysis are moved to the front of the queue. Decisions pick the most recently bumped unassigned
+     * variable. A search pointer marks a position such that all more recently bumped variables are assigned, which
+     * makes decisions and bumps amortized O(1).
+     * @note This heuristic subscribes to SearchEvents and can neither be copied nor moved. Wrap it in a
+     * MovableHeuristic before passing it to the solver
+     */
+    class VMTF {
+        static constexpr unsigned None = std::numeric_limits<unsigned>::max();
+        std::vector<unsigned> prev; ///< per variable: next less recently bumped variable
+        std::vector<unsigned> next; ///< per variable: next more recently bumped variable
+        std::vector<std::uint64_t> stamps; ///< per variable: time of the last bump
+        std::vector<Variable> bumped;
+        unsigned first = None; ///< least recently bumped variable
+        unsigned last = None; ///< most recently bumped variable
+        unsigned search = None;
+        std::uint64_t time = 0;
+        SubscriberHandle unassignHandle;
+        SubscriberHandle conflictHandle;
+
+        void moveToFront(unsigned varId);
+
+    public:
+        /**
+         * Ctor
+         * @param numVariables number of variables in the problem
+         * @param events events of the solver that uses the heuristic
+         */
+        VMTF(unsigned numVariables, SearchEvents &events);
+
+        VMTF(const VMTF &) = delete;
+
+        VMTF &operator=(const VMTF &) = delete;
+
+        Variable operator()(const std::vector<TruthValue> &model, std::size_t);
+    };
+
     namespace detail {
         /**
          * @brief This is a helper class for the implementation of a type erasure heuristic wrapper
@@ -117,6 +224,17 @@ namespace sat {
             return h->operator()(values, numOpenVariables);
         }
     };
+
+    PENUM(BranchingStrategy, EVSIDS, VMTF, FirstVariable)
+
+    /**
+     * Creates a branching heuristic with default parameters
+     * @param strategy the desired branching strategy
+     * @param numVariables number of variables in the problem
+     * @param events events of the solver that uses the heuristic
+     * @return heuristic wrapper
+     */
+    Heuristic makeHeuristic(BranchingStrategy strategy, unsigned numVariables, SearchEvents &events);
 }
 
 #endif //HEURISTICS_HPP
@@ -0,0 +1,95 @@
+/**
+* @date 16.10.26
+* @brief
+*/
+
+#include "restart.hpp"
+#include "util/exception.hpp"
+
+namespace sat {
+    bool NoRestarts::operator()(unsigned) const noexcept {
+        return false;
+    }
+
+    LubyRestarts::LubyRestarts(std::size_t unit) : unit(unit), limit(unit * luby(1)) {}
+
+    bool LubyRestarts::operator()(unsigned) noexcept {
+        if (++conflicts < limit) {
+            return false;
+        }
+
+        conflicts = 0;
+        limit = unit * luby(++index);
+        return true;
+    }
+
+    std::size_t LubyRestarts::luby(std::size_t i) noexcept {
+        // find the finite subsequence that contains index i and the size of that subsequence
+        std::size_t x = i - 1;
+        std::size_t size = 1;
+        std::size_t exponent = 0;
+        while (size < x + 1) {
+            ++exponent;
+            size = 2 * size + 1;
+        }
+
+        while (size - 1 != x) {
+            size = (size - 1) / 2;
+            --exponent;
+            x %= size;
+        }
+
+        return std::size_t(1) << exponent;
+    }
+
+    GlucoseRestarts::Ema::Ema(double alpha) noexcept: alpha(alpha) {}
+
+    void GlucoseRestarts::Ema::update(double x) noexcept {
+        value += alpha * (x - value);
+        beta *= 1 - alpha;
+    }
+
+    double GlucoseRestarts::Ema::get() const noexcept {
+        // correct the bias towards the initial value 0 during the first updates
+        return beta < 1 ? value / (1 - beta) : 0;
+    }
+
+    GlucoseRestarts::GlucoseRestarts(double fastWindow, double slowWindow, double margin, std::size_t minConflicts)
+        : fast(1 / fastWindow), slow(1 / slowWindow), margin(margin), minConflicts(minConflicts) {}
+
+    bool GlucoseRestarts::operator()(unsigned lbd) noexcept {
+        fast.update(lbd);
+        slow.update(lbd);
+        if (++conflicts < minConflicts || fast.get() <= margin * slow.get()) {
+            return false;
+        }
+
+        conflicts = 0;
+        return true;
+    }
+
+    bool RestartPolicy::operator()(unsigned lbd) const {
+        if (nullptr == impl) {
+            throw BadRestartPolicyCall("restart policy wrapper does not contain a restart policy");
+        }
+
+        return impl->invoke(lbd);
+    }
+
+    bool RestartPolicy::isValid() const {
+        return nullptr != impl;
+    }
+
+    RestartPolicy makeRestartPolicy(RestartStrategy strategy) {
+        switch (strategy) {
+            case RestartStrategy::None:
+                return NoRestarts{};
+            case RestartStrategy::Luby:
+                return LubyRestarts{};
+            case RestartStrategy::Glucose:
+                return GlucoseRestarts{};
+        }
+
+        throw std::invalid_argument("unknown restart strategy");
+    }
+}
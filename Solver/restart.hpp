@@ -0,0 +1,176 @@
+/**
+* @date 16.10.26
+* @file restart.hpp
+* @brief Contains different restart policies
+*/
+
+#ifndef RESTART_HPP
+#define RESTART_HPP
+
+#include <memory>
+#include <cstddef>
+
+#include "util/concepts.hpp"
+#include "util/enum.hpp"
+
+namespace sat {
+    /**
+     * Concept modelling the restart policy interface. A restart policy is a type that is called after every conflict
+     * with the literal block distance of the learned clause and returns whether the solver should restart now
+     */
+    template<typename R>
+    concept restart_policy = concepts::callable_r<R, bool, unsigned>;
+
+    /**
+     * @brief Restart policy that never restarts
+     */
+    struct NoRestarts {
+        bool operator()(unsigned) const noexcept;
+    };
+
+    /**
+     * @brief Restart policy with restart intervals following the Luby sequence (1, 1, 2, 1, 1, 2, 4, 1, ...)
+     * scaled by a constant number of conflicts
+     */
+    class LubyRestarts {
+        std::size_t unit;
+        std::size_t index = 1;
+        std::size_t conflicts = 0;
+        std::size_t limit;
+    public:
+        /**
+         * Ctor
+         * @param unit number of conflicts corresponding to one unit of the Luby sequence
+         */
+        explicit LubyRestarts(std::size_t unit = 100);
+
+        bool operator()(unsigned) noexcept;
+
+        /**
+         * Computes the i-th element of the Luby sequence
+         * @param i index starting at 1
+         * @return i-th element of the Luby sequence
+         */
+        static std::size_t luby(std::size_t i) noexcept;
+    };
+
+    /**
+     * @brief Glucose style dynamic restart policy.
+     * @details @copybrief
+     * Maintains a fast and a slow exponential moving average of the LBD of learned clauses. If the fast average
+     * exceeds the slow average by a given margin, the recently learned clauses are worse than usual which indicates
+     * that the solver is stuck in an unpromising region of the search space.
+     */
+    class GlucoseRestarts {
+        /**
+         * @brief Bias corrected exponential moving average
+         */
+        class Ema {
+            double alpha;
+            double value = 0;
+            double beta = 1;
+        public:
+            explicit Ema(double alpha) noexcept;
+
+            void update(double x) noexcept;
+
+            double get() const noexcept;
+        };
+
+        Ema fast;
+        Ema slow;
+        double margin;
+        std::size_t minConflicts;
+        std::size_t conflicts = 0;
+    public:
+        /**
+         * Ctor
+         * @param fastWindow approximate number of conflicts covered by the fast average
+         * @param slowWindow approximate number of conflicts covered by the slow average
+         * @param margin restart if fast average > margin * slow average
+         * @param minConflicts minimum number of conflicts between two restarts
+         */
+        explicit GlucoseRestarts(double fastWindow = 32, double slowWindow = 1e5, double margin = 1.25,
+                                 std::size_t minConflicts = 50);
+
+        bool operator()(unsigned lbd) noexcept;
+    };
+
+    namespace detail {
+        /**
+         * @brief This is a helper class for the implementation of a type erasure restart policy wrapper
+         */
+        struct RestartPolicyBase {
+            RestartPolicyBase() = default;
+
+            virtual ~RestartPolicyBase() = default;
+
+            RestartPolicyBase(RestartPolicyBase &&) = default;
+
+            RestartPolicyBase &operator=(RestartPolicyBase &&) = default;
+
+            RestartPolicyBase(const RestartPolicyBase &) = default;
+
+            RestartPolicyBase &operator=(const RestartPolicyBase &) = default;
+
+            virtual bool invoke(unsigned lbd) = 0;
+        };
+
+        /**
+         * @brief This is a helper class for the implementation of a type erasure restart policy wrapper
+         */
+        template<restart_policy R>
+        struct RestartPolicyImpl : RestartPolicyBase {
+            R impl;
+
+            template<typename... Args>
+            explicit RestartPolicyImpl(Args &&... args): impl(std::forward<Args>(args)...) {
+            }
+
+            bool invoke(unsigned lbd) override {
+                return impl(lbd);
+            }
+        };
+    }
+
+    /**
+     * @brief Type erasure restart policy wrapper that can hold any type of restart policy
+     */
+    class RestartPolicy {
+        std::unique_ptr<detail::RestartPolicyBase> impl;
+    public:
+        /**
+         * Default Ctor. Constructs an empty restart policy that must not be called
+         */
+        RestartPolicy() = default;
+
+        /**
+         * Ctor.
+         * @tparam R restart policy type
+         * @param policy The restart policy to store in the wrapper
+         */
+        template<restart_policy R>
+        RestartPolicy(R &&policy): impl(
+            std::make_unique<detail::RestartPolicyImpl<std::remove_cvref_t<R>>>(std::forward<R>(policy))) {
+        }
+
+        bool operator()(unsigned lbd) const;
+
+        /**
+         * Whether the wrapper holds a valid restart policy
+         * @return true if restart policy wrapper is valid, false otherwise
+         */
+        bool isValid() const;
+    };
+
+    PENUM(RestartStrategy, None, Luby, Glucose)
+
+    /**
+     * Creates a restart policy with default parameters
+     * @param strategy the desired restart strategy
+     * @return restart policy wrapper
+     */
+    RestartPolicy makeRestartPolicy(RestartStrategy strategy);
+}
+
+#endif //RESTART_HPP
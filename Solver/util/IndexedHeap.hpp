@@ -0,0 +1,144 @@
+/**
+* @date 16.10.26
+* @file IndexedHeap.hpp
+* @brief Contains a binary heap over integer ids that supports membership queries and priority updates
+*/
+
+#ifndef INDEXEDHEAP_HPP
+#define INDEXEDHEAP_HPP
+
+#include <vector>
+#include <cstddef>
+#include <limits>
+
+namespace sat {
+    /**
+     * @brief Binary max-heap over the ids [0, n). The position of each id in the heap is tracked, so that membership
+     * queries are O(1) and insertion, removal of the top and priority increases are O(log n).
+     * @tparam Less comparison functor on ids. The ids are ordered according to the priorities it refers to, so the
+     * functor is usually a reference to an external priority table.
+     */
+    template<typename Less>
+    class IndexedHeap {
+        static constexpr std::size_t NotInHeap = std::numeric_limits<std::size_t>::max();
+        std::vector<unsigned> heap;
+        std::vector<std::size_t> positions;
+        Less less;
+
+        void siftUp(std::size_t pos) {
+            const unsigned id = heap[pos];
+            while (pos > 0) {
+                const std::size_t parent = (pos - 1) / 2;
+                if (!less(heap[parent], id)) {
+                    break;
+                }
+
+                heap[pos] = heap[parent];
+                positions[heap[pos]] = pos;
+                pos = parent;
+            }
+
+            heap[pos] = id;
+            positions[id] = pos;
+        }
+
+        void siftDown(std::size_t pos) {
+            const unsigned id = heap[pos];
+            while (true) {
+                std::size_t child = 2 * pos + 1;
+                if (child >= heap.size()) {
+                    break;
+                }
+
+                if (child + 1 < heap.size() && less(heap[child], heap[child + 1])) {
+                    ++child;
+                }
+
+                if (!less(id, heap[child])) {
+                    break;
+                }
+
+                heap[pos] = heap[child];
+                positions[heap[pos]] = pos;
+                pos = child;
+            }
+
+            heap[pos] = id;
+            positions[id] = pos;
+        }
+
+    public:
+        /**
+         * Ctor. Creates an empty heap
+         * @param numIds number of ids
+         * @param less comparison functor
+         */
+        explicit IndexedHeap(std::size_t numIds, Less less = Less{}) : positions(numIds, NotInHeap),
+                                                                       less(std::move(less)) {
+            heap.reserve(numIds);
+        }
+
+        /**
+         * Whether the given id is in the heap
+         */
+        bool contains(unsigned id) const noexcept {
+            return positions[id] != NotInHeap;
+        }
+
+        bool empty() const noexcept {
+            return heap.empty();
+        }
+
+        std::size_t size() const noexcept {
+            return heap.size();
+        }
+
+        /**
+         * Inserts an id. Does nothing if the id is already in the heap
+         * @param id
+         */
+        void insert(unsigned id) {
+            if (contains(id)) {
+                return;
+            }
+
+            heap.emplace_back(id);
+            siftUp(heap.size() - 1);
+        }
+
+        /**
+         * Restores the heap property after the priority of an id has been increased
+         * @param id
+         */
+        void increased(unsigned id) {
+            if (contains(id)) {
+                siftUp(positions[id]);
+            }
+        }
+
+        /**
+         * Id with the highest priority (heap must not be empty)
+         */
+        unsigned top() const noexcept {
+            return heap.front();
+        }
+
+        /**
+         * Removes and returns the id with the highest priority (heap must not be empty)
+         * @return the removed id
+         */
+        unsigned pop() {
+            const unsigned id = heap.front();
+            positions[id] = NotInHeap;
+            heap.front() = heap.back();
+            heap.pop_back();
+            if (!heap.empty()) {
+                siftDown(0);
+            }
+
+            return id;
+        }
+    };
+}
+
+#endif //INDEXEDHEAP_HPP
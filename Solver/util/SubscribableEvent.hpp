@@ -227,6 +227,15 @@ namespace sat {
             }
         }
 
+        /**
+         * Whether any event handler is subscribed. Handlers that unsubscribed since the last trigger may still be
+         * counted
+         * @return true if trigger may invoke at least one handler, false otherwise
+         */
+        [[nodiscard]] bool hasSubscribers() const noexcept {
+            return not handlers.empty();
+        }
+
     private:
         template<typename Handler>
         SubscriberHandle subscribe(Handler &&handlerFunction, bool discardHandler) {
@@ -0,0 +1,72 @@
+/**
+* @date 16.10.26
+* @file WorkStealingQueue.hpp
+* @brief Contains a double ended task queue for work stealing thread pools
+*/
+
+#ifndef WORKSTEALINGQUEUE_HPP
+#define WORKSTEALINGQUEUE_HPP
+
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace sat {
+    /**
+     * @brief Task queue of a worker in a work stealing thread pool. The owner pushes and pops tasks at the back,
+     * other workers steal from the front, so that owner and thieves rarely contend for the same tasks.
+     * @tparam T task type
+     */
+    template<typename T>
+    class WorkStealingQueue {
+        std::deque<T> tasks;
+        mutable std::mutex mutex;
+
+    public:
+        /**
+         * Adds a task at the back
+         * @param task the task
+         */
+        void push(T task) {
+            std::lock_guard lock(mutex);
+            tasks.emplace_back(std::move(task));
+        }
+
+        /**
+         * Removes the task at the back. Used by the owner
+         * @return the task or std::nullopt if the queue is empty
+         */
+        std::optional<T> pop() {
+            std::lock_guard lock(mutex);
+            if (tasks.empty()) {
+                return std::nullopt;
+            }
+
+            T task = std::move(tasks.back());
+            tasks.pop_back();
+            return task;
+        }
+
+        /**
+         * Removes the task at the front. Used by other workers
+         * @return the task or std::nullopt if the queue is empty
+         */
+        std::optional<T> steal() {
+            std::lock_guard lock(mutex);
+            if (tasks.empty()) {
+                return std::nullopt;
+            }
+
+            T task = std::move(tasks.front());
+            tasks.pop_front();
+            return task;
+        }
+
+        bool empty() const {
+            std::lock_guard lock(mutex);
+            return tasks.empty();
+        }
+    };
+}
+
+#endif //WORKSTEALINGQUEUE_HPP
@@ -15,3 +15,9 @@ BadHeuristicCall::BadHeuristicCall(std::string message) : message(std::move(mess
 const char * BadHeuristicCall::what() const noexcept {
     return message.c_str();
 }
+
+BadRestartPolicyCall::BadRestartPolicyCall(std::string message) : message(std::move(message)){}
+
+const char * BadRestartPolicyCall::what() const noexcept {
+    return message.c_str();
+}
@@ -2,7 +2,7 @@
 * @author Tim Luchterhand
 * @date 28.11.24
 * @file exception.hpp
-* @brief Not implemented exception and BadHeuristicCall exception
+* @brief Not implemented exception, BadHeuristicCall and BadRestartPolicyCall exceptions
 */
 
 #ifndef EXCEPTION_HPP
@@ -23,6 +23,13 @@ public:
     const char *what() const noexcept override;
 };
 
+class BadRestartPolicyCall : public std::bad_function_call {
+    std::string message;
+public:
+    BadRestartPolicyCall(std::string message = {});
+    const char *what() const noexcept override;
+};
+
 #define NOT_IMPLEMENTED NotImplementedException(__PRETTY_FUNCTION__)
 
 
@@ -12,7 +12,7 @@ namespace sat {
     }
 
     RNG & RNG::get() {
-        static RNG rng;
+        thread_local RNG rng;
         return rng;
     }
 
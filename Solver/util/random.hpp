@@ -13,7 +13,8 @@
 
 namespace sat {
     /**
-    * @brief Random number generator singleton class
+    * @brief Random number generator singleton class. There is one instance per thread, so that threads neither share
+    * nor synchronize on the generator state
     */
     class RNG {
         std::random_device rd;
@@ -30,13 +31,13 @@ namespace sat {
         ~RNG() = default;
 
         /**
-        * Get the instance of the random number generator
+        * Get the instance of the random number generator of the calling thread
         * @return instance of the random number generator
         */
         static RNG &get();
 
         /**
-        * Sets the random seed
+        * Sets the random seed of the calling thread's generator
         * @param seed the desired seed
         */
         void setSeed(unsigned seed);
@@ -13,9 +13,9 @@ TEST(structures, basic_ctors) {
     using namespace sat;
     Variable x = 3;
     Literal l = 7;
-    EXPECT_EQ(l.get(), 7);
+    EXPECT_EQ(l.get(), 7u);
     EXPECT_EQ(l, 7);
-    EXPECT_EQ(x.get(), 3);
+    EXPECT_EQ(x.get(), 3u);
     EXPECT_EQ(x, 3);
 }
 
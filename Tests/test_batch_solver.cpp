@@ -0,0 +1,111 @@
+/**
+* @date 16.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <filesystem>
+#include <fstream>
+
+#include "BatchSolver.hpp"
+#include "testing_utils.hpp"
+
+TEST(batch_solver, collect_instances) {
+    using namespace sat;
+    const auto files = collectInstances(__EVAL_DATA_DIR__ "unsat");
+    ASSERT_EQ(files.size(), 12u);
+    EXPECT_TRUE(std::ranges::is_sorted(files));
+    EXPECT_THAT(collectInstances(test::TestData::SatEasy1), testing::ElementsAre(test::TestData::SatEasy1));
+    const auto listFile = std::filesystem::temp_directory_path() / "batch_solver_instances.txt";
+    {
+        std::ofstream list(listFile);
+        list << test::TestData::SatEasy1 << "\n\n" << test::TestData::UnsatEasy1 << "\n";
+    }
+
+    EXPECT_THAT(collectInstances(listFile.string()),
+                testing::ElementsAre(test::TestData::SatEasy1, test::TestData::UnsatEasy1));
+    std::filesystem::remove(listFile);
+    EXPECT_THROW(collectInstances(__EVAL_DATA_DIR__ "does_not_exist"), std::runtime_error);
+}
+
+TEST(batch_solver, max_in_flight) {
+    using namespace sat;
+    BatchOptions options;
+    options.numThreads = 8;
+    EXPECT_EQ(maxInFlight(options), 8u);
+    // without a limit per instance, the budget cannot be divided
+    options.memoryBudget = 350;
+    EXPECT_EQ(maxInFlight(options), 8u);
+    options.memoryLimit = 100;
+    EXPECT_EQ(maxInFlight(options), 3u);
+    options.memoryBudget = 50;
+    EXPECT_EQ(maxInFlight(options), 1u);
+}
+
+TEST(batch_solver, solve) {
+    using namespace sat;
+    const std::vector<std::string> files{test::TestData::SatEasy1, test::TestData::UnsatEasy1,
+                                         test::TestData::SatMedium, __EVAL_DATA_DIR__ "does_not_exist.cnf",
+                                         test::TestData::UnsatEasy2};
+    std::vector<std::string> reported;
+    BatchOptions options;
+    options.numThreads = 3;
+    const auto results = solveBatch(files, options, [&reported](const InstanceResult &result) {
+        reported.emplace_back(result.file);
+    });
+
+    ASSERT_EQ(results.size(), files.size());
+    EXPECT_THAT(reported, testing::UnorderedElementsAreArray(files));
+    const std::vector expected{InstanceStatus::Sat, InstanceStatus::Unsat, InstanceStatus::Sat,
+                               InstanceStatus::Error, InstanceStatus::Unsat};
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        EXPECT_EQ(results[i].file, files[i]);
+        EXPECT_EQ(results[i].status, expected[i]) << "wrong status for " << files[i];
+    }
+}
+
+TEST(batch_solver, limits) {
+    using namespace sat;
+    const std::vector<std::string> files{test::TestData::UnsatPigeonHole};
+    BatchOptions memoryLimited;
+    memoryLimited.memoryLimit = 1;
+    auto results = solveBatch(files, memoryLimited);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results.front().status, InstanceStatus::Memout);
+    BatchOptions timeLimited;
+    timeLimited.timeLimit = std::chrono::milliseconds(1);
+    results = solveBatch(files, timeLimited);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results.front().status, InstanceStatus::Timeout);
+}
+
+TEST(batch_solver, time_limit_per_instance) {
+    using namespace sat;
+    // more instances than threads: the shared watcher must enforce the deadline of every instance
+    const std::vector<std::string> files(4, test::TestData::UnsatPigeonHole);
+    BatchOptions options;
+    options.numThreads = 2;
+    options.timeLimit = std::chrono::milliseconds(20);
+    const auto results = solveBatch(files, options);
+    ASSERT_EQ(results.size(), files.size());
+    for (const auto &result : results) {
+        EXPECT_EQ(result.status, InstanceStatus::Timeout);
+    }
+}
+
+TEST(batch_solver, cancel) {
+    using namespace sat;
+    std::stop_source stop;
+    stop.request_stop();
+    const auto results = solveBatch({test::TestData::SatEasy1}, BatchOptions{}, {}, stop.get_token());
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results.front().status, InstanceStatus::Cancelled);
+}
+
+#ifndef __RUN_ALL_TESTS__
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
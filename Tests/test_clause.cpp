@@ -10,6 +10,7 @@
 
 #include "util/concepts.hpp"
 #include "Clause.hpp"
+#include "ClauseArena.hpp"
 #include "testing_utils.hpp"
 
 
@@ -78,6 +79,91 @@ TEST(clause, watcher_index) {
     EXPECT_EQ(c.getWatcherByRank(1), c[c.getIndex(1)]);
 }
 
+TEST(clause, arena_alloc) {
+    using namespace sat;
+    ClauseArena arena;
+    std::vector<Literal> lits1{5, 2, 3};
+    std::vector<Literal> lits2{7, 0};
+    const auto c1 = arena.alloc(lits1, false);
+    const auto c2 = arena.alloc(lits2, true);
+    EXPECT_NE(c1, c2);
+    EXPECT_EQ(arena[c1].size(), 3u);
+    EXPECT_EQ(arena[c2].size(), 2u);
+    EXPECT_FALSE(arena[c1].learned());
+    EXPECT_TRUE(arena[c2].learned());
+    EXPECT_TRUE(std::ranges::equal(arena[c1], lits1));
+    EXPECT_TRUE(std::ranges::equal(arena[c2], lits2));
+    static_assert(clause_like<ClauseView>);
+}
+
+TEST(clause, arena_modify) {
+    using namespace sat;
+    ClauseArena arena;
+    const auto c1 = arena.alloc(std::vector<Literal>{5, 2, 3}, false);
+    const auto c2 = arena.alloc(std::vector<Literal>{1, 4}, false);
+    arena[c1].swap(0, 2);
+    arena[c2].set(1, 9);
+    EXPECT_EQ(arena[c1][0], 3);
+    EXPECT_EQ(arena[c1][2], 5);
+    EXPECT_EQ(arena[c2][0], 1);
+    EXPECT_EQ(arena[c2][1], 9);
+}
+
+TEST(clause, arena_metadata) {
+    using namespace sat;
+    ClauseArena arena;
+    const auto c = arena.alloc(std::vector<Literal>{1, 4, 6}, true);
+    auto clause = arena[c];
+    EXPECT_TRUE(clause.learned());
+    EXPECT_FALSE(clause.used());
+    clause.setLbd(3);
+    clause.setTier(ClauseTier::Mid);
+    clause.setUsed(true);
+    EXPECT_EQ(clause.lbd(), 3u);
+    EXPECT_EQ(clause.tier(), ClauseTier::Mid);
+    EXPECT_TRUE(clause.used());
+    clause.setLbd(2);
+    clause.setUsed(false);
+    EXPECT_EQ(clause.lbd(), 2u);
+    EXPECT_EQ(clause.tier(), ClauseTier::Mid);
+    EXPECT_FALSE(clause.used());
+    EXPECT_TRUE(clause.learned());
+    EXPECT_EQ(clause.size(), 3u);
+}
+
+TEST(clause, arena_relocate) {
+    using namespace sat;
+    ClauseArena arena;
+    const auto c1 = arena.alloc(std::vector<Literal>{1, 4, 6}, false);
+    const auto c2 = arena.alloc(std::vector<Literal>{3, 8}, true);
+    const auto c3 = arena.alloc(std::vector<Literal>{2, 5, 7, 9}, false);
+    arena.free(c2);
+    EXPECT_TRUE(arena[c2].deleted());
+    EXPECT_EQ(arena.wasted(), ClauseView::HeaderSize + 2);
+    ClauseArena to;
+    const auto n3 = arena.relocate(c3, to);
+    const auto n1 = arena.relocate(c1, to);
+    EXPECT_EQ(arena.relocate(c3, to), n3);
+    EXPECT_EQ(to.size(), arena.size() - arena.wasted());
+    EXPECT_EQ(to.wasted(), 0u);
+    EXPECT_TRUE(std::ranges::equal(to[n1], std::vector<Literal>{1, 4, 6}));
+    EXPECT_TRUE(std::ranges::equal(to[n3], std::vector<Literal>{2, 5, 7, 9}));
+    EXPECT_FALSE(to[n1].learned());
+}
+
+TEST(clause, arena_signature) {
+    using namespace sat;
+    ClauseArena arena;
+    const auto c1 = arena.alloc(std::vector{pos(1), neg(2)}, false);
+    const auto c2 = arena.alloc(std::vector{neg(1), pos(2), pos(7)}, false);
+    const auto c3 = arena.alloc(std::vector{pos(1), pos(3)}, false);
+    EXPECT_EQ(arena[c1].signature() & ~arena[c2].signature(), 0u);
+    EXPECT_NE(arena[c3].signature() & ~arena[c2].signature(), 0u);
+    arena.shrink(c2, 2);
+    EXPECT_EQ(arena[c2].size(), 2u);
+    EXPECT_EQ(arena[c2].signature(), arena[c1].signature());
+}
+
 #ifndef __RUN_ALL_TESTS__
 
 int main(int argc, char **argv) {
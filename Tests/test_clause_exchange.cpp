@@ -0,0 +1,144 @@
+/**
+* @date 16.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <thread>
+
+#include "ClauseExchange.hpp"
+#include "testing_utils.hpp"
+
+TEST(clause_exchange, ring_push_pop) {
+    using namespace sat;
+    ClauseRing ring(4);
+    std::uint64_t position = 0;
+    std::vector<Literal> literals;
+    unsigned lbd = 0;
+    EXPECT_FALSE(ring.pop(position, literals, lbd));
+    ring.push(std::vector{pos(0), neg(1)}, 2);
+    ASSERT_TRUE(ring.pop(position, literals, lbd));
+    EXPECT_THAT(literals, testing::ElementsAre(pos(0), neg(1)));
+    EXPECT_EQ(lbd, 2u);
+    EXPECT_FALSE(ring.pop(position, literals, lbd));
+
+    // a consumer that falls behind skips overwritten clauses
+    for (unsigned i = 0; i < 6; ++i) {
+        ring.push(std::vector{pos(i)}, 1);
+    }
+
+    ASSERT_TRUE(ring.pop(position, literals, lbd));
+    EXPECT_THAT(literals, testing::ElementsAre(pos(2)));
+    std::uint64_t otherPosition = 0;
+    ASSERT_TRUE(ring.pop(otherPosition, literals, lbd));
+    EXPECT_THAT(literals, testing::ElementsAre(pos(2)));
+}
+
+TEST(clause_exchange, ring_concurrent) {
+    using namespace sat;
+    constexpr unsigned NumClauses = 100000;
+    ClauseRing ring(64);
+    std::atomic_bool done = false;
+    auto consume = [&] {
+        std::uint64_t position = 0;
+        std::vector<Literal> literals;
+        unsigned lbd = 0;
+        unsigned last = 0;
+        while (true) {
+            const bool finished = done;
+            if (!ring.pop(position, literals, lbd)) {
+                if (finished) {
+                    break;
+                }
+
+                continue;
+            }
+
+            // clause i consists of the literals i, ..., i + lbd - 1, a torn read would mix two clauses
+            ASSERT_EQ(literals.size(), lbd);
+            for (std::size_t k = 0; k < literals.size(); ++k) {
+                ASSERT_EQ(literals[k].get(), literals.front().get() + k);
+            }
+
+            ASSERT_GE(literals.front().get(), last);
+            last = literals.front().get();
+        }
+    };
+
+    std::jthread first(consume);
+    std::jthread second(consume);
+    std::vector<Literal> literals;
+    for (unsigned i = 0; i < NumClauses; ++i) {
+        literals.clear();
+        const unsigned size = 1 + i % ClauseRing::SlotSize;
+        for (unsigned k = 0; k < size; ++k) {
+            literals.emplace_back(i + k);
+        }
+
+        ring.push(literals, size);
+    }
+
+    done = true;
+}
+
+TEST(clause_exchange, filter_and_duplicates) {
+    using namespace sat;
+    ClauseExchange exchange(3, 3, 2);
+    auto first = exchange.connect(0);
+    auto second = exchange.connect(1);
+    auto third = exchange.connect(2);
+    EXPECT_TRUE(first.exportClause(std::vector{pos(0), pos(1)}, 2));
+    EXPECT_FALSE(first.exportClause(std::vector{pos(1), pos(0)}, 2));
+    EXPECT_FALSE(first.exportClause(std::vector{pos(0), pos(1), pos(2), pos(3)}, 2));
+    EXPECT_FALSE(first.exportClause(std::vector{pos(2), pos(3)}, 3));
+    EXPECT_TRUE(second.exportClause(std::vector{pos(1), pos(0)}, 1));
+    EXPECT_TRUE(second.exportClause(std::vector{neg(4)}, 1));
+
+    std::vector<Literal> literals;
+    unsigned lbd = 0;
+    // third receives (x0 | x1) only once
+    std::vector<std::vector<Literal>> received;
+    while (third.importClause(literals, lbd)) {
+        received.emplace_back(literals);
+    }
+
+    EXPECT_EQ(received.size(), 2u);
+    EXPECT_TRUE(test::findClause(std::vector{pos(0), pos(1)}, received));
+    EXPECT_TRUE(test::findClause(std::vector{neg(4)}, received));
+    // first already knows (x0 | x1), second knows both clauses of first and does not import its own clauses
+    ASSERT_TRUE(first.importClause(literals, lbd));
+    EXPECT_THAT(literals, testing::ElementsAre(neg(4)));
+    EXPECT_FALSE(first.importClause(literals, lbd));
+    EXPECT_FALSE(second.importClause(literals, lbd));
+}
+
+TEST(clause_exchange, solvers_share_clauses) {
+    using namespace sat;
+    auto [clauses, numVariables] = test::loadProblem(test::TestData::UnsatPigeonHole);
+    ClauseExchange exchange(2);
+    Solver producer(numVariables);
+    Solver consumer(numVariables);
+    producer.setClauseSharing(exchange.connect(0));
+    consumer.setClauseSharing(exchange.connect(1));
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(producer.addClause(Clause(clause)));
+        ASSERT_TRUE(consumer.addClause(Clause(clause)));
+    }
+
+    ASSERT_EQ(producer.solve(), SolveResult::Unsat);
+    EXPECT_GT(producer.getStatistics().exportedClauses, 0u);
+    ASSERT_EQ(consumer.solve(), SolveResult::Unsat);
+    EXPECT_GT(consumer.getStatistics().importedClauses, 0u);
+    EXPECT_LE(consumer.getStatistics().usefulImports, consumer.getStatistics().importedClauses);
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
@@ -0,0 +1,115 @@
+/**
+* @date 16.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "CubeAndConquer.hpp"
+#include "util/WorkStealingQueue.hpp"
+#include "testing_utils.hpp"
+
+TEST(cube_and_conquer, work_stealing_queue) {
+    using namespace sat;
+    WorkStealingQueue<int> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop().has_value());
+    EXPECT_FALSE(queue.steal().has_value());
+    for (int i = 0; i < 4; ++i) {
+        queue.push(i);
+    }
+
+    EXPECT_EQ(queue.pop(), 3);
+    EXPECT_EQ(queue.steal(), 0);
+    EXPECT_EQ(queue.steal(), 1);
+    EXPECT_EQ(queue.pop(), 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(cube_and_conquer, generate_cubes) {
+    using namespace sat;
+    const auto [clauses, numVariables] = test::loadProblem(test::TestData::SatMedium);
+    constexpr unsigned Depth = 4;
+    const auto cubes = CubeGenerator(clauses, numVariables).generate(Depth);
+    ASSERT_FALSE(cubes.empty());
+    EXPECT_LE(cubes.size(), 1u << Depth);
+    for (const auto &cube : cubes) {
+        // literals of a cube are consistent
+        std::vector<bool> seen(numVariables, false);
+        for (Literal l : cube) {
+            EXPECT_FALSE(seen[var(l).get()]);
+            seen[var(l).get()] = true;
+        }
+    }
+}
+
+TEST(cube_and_conquer, generate_cubes_unsat) {
+    using namespace sat;
+    // (x0) & (-x0 | x1) & (-x1)
+    const std::vector<std::vector<Literal>> clauses{{pos(0)}, {neg(0), pos(1)}, {neg(1)}};
+    EXPECT_TRUE(CubeGenerator(clauses, 2).generate(3).empty());
+}
+
+TEST(cube_and_conquer, generate_cubes_skips_unused_variables) {
+    using namespace sat;
+    // (x0 | x1) & (-x0 | -x1), the remaining variables occur in no clause
+    const std::vector<std::vector<Literal>> clauses{{pos(0), pos(1)}, {neg(0), neg(1)}};
+    const auto cubes = CubeGenerator(clauses, 6).generate(4);
+    EXPECT_EQ(cubes.size(), 2u);
+    for (const auto &cube : cubes) {
+        for (Literal l : cube) {
+            EXPECT_LT(var(l).get(), 2u);
+        }
+    }
+}
+
+void expectCubeResult(const std::string &cnfFile, sat::SolveResult expected, unsigned numWorkers) {
+    using namespace sat;
+    const auto [clauses, numVariables] = test::loadProblem(cnfFile);
+    const auto outcome = solveCubes(clauses, numVariables, makePortfolio(numWorkers), 5);
+    ASSERT_EQ(outcome.result, expected) << "wrong result for " << cnfFile;
+    EXPECT_LE(outcome.solvedCubes + outcome.prunedCubes, outcome.cubes);
+    if (expected == SolveResult::Sat) {
+        EXPECT_TRUE(test::isModel(clauses, outcome.model)) << "invalid model for " << cnfFile;
+    }
+}
+
+TEST(cube_and_conquer, solve) {
+    using namespace sat;
+    for (unsigned numWorkers : {1u, 4u}) {
+        expectCubeResult(test::TestData::SatMedium, SolveResult::Sat, numWorkers);
+        expectCubeResult(test::TestData::UnsatEasy1, SolveResult::Unsat, numWorkers);
+        expectCubeResult(test::TestData::UnsatPigeonHole, SolveResult::Unsat, numWorkers);
+    }
+}
+
+TEST(cube_and_conquer, unresolved_cube) {
+    using namespace sat;
+    const auto [clauses, numVariables] = test::loadProblem(test::TestData::UnsatPigeonHole);
+    auto configs = makePortfolio(2);
+    for (auto &config : configs) {
+        // every cube that needs a conflict exceeds the memory limit
+        config.memoryLimit = 1;
+    }
+
+    const auto outcome = solveCubes(clauses, numVariables, configs, 5);
+    EXPECT_NE(outcome.result, SolveResult::Unsat);
+    EXPECT_EQ(outcome.result, SolveResult::Unknown);
+}
+
+TEST(cube_and_conquer, cancel) {
+    using namespace sat;
+    const auto [clauses, numVariables] = test::loadProblem(test::TestData::UnsatPigeonHole);
+    std::stop_source stop;
+    stop.request_stop();
+    const auto outcome = solveCubes(clauses, numVariables, makePortfolio(4), 5, stop.get_token());
+    EXPECT_EQ(outcome.result, SolveResult::Unknown);
+}
+
+#ifndef __RUN_ALL_TESTS__
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
@@ -0,0 +1,83 @@
+/**
+* @date 16.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "LocalSearch.hpp"
+#include "testing_utils.hpp"
+
+TEST(local_search, falsified_clauses) {
+    using namespace sat;
+    // (x0 | x1) & (-x0 | x2) & (-x1 | -x2) & (x0 | x0 | -x0)
+    const std::vector<std::vector<Literal>> clauses{{pos(0), pos(1)}, {neg(0), pos(2)}, {neg(1), neg(2)},
+                                                    {pos(0), pos(0), neg(0)}};
+    LocalSearch localSearch(clauses, 3);
+    localSearch.setAssignment({TruthValue::False, TruthValue::False, TruthValue::False});
+    EXPECT_EQ(localSearch.numFalsified(), 1u);
+    localSearch.setAssignment({TruthValue::True, TruthValue::True, TruthValue::True});
+    EXPECT_EQ(localSearch.numFalsified(), 1u);
+    localSearch.setAssignment({TruthValue::True, TruthValue::False, TruthValue::True});
+    EXPECT_EQ(localSearch.numFalsified(), 0u);
+    EXPECT_EQ(localSearch.search(100), SolveResult::Sat);
+    EXPECT_EQ(localSearch.getNumFlips(), 0u);
+}
+
+TEST(local_search, unsat) {
+    using namespace sat;
+    const std::vector<std::vector<Literal>> clauses{{pos(0)}, {neg(0)}, {pos(1)}};
+    LocalSearch localSearch(clauses, 2);
+    EXPECT_EQ(localSearch.search(1000), SolveResult::Unknown);
+    EXPECT_EQ(localSearch.getNumFlips(), 1000u);
+    EXPECT_EQ(localSearch.numFalsified(), 1u);
+}
+
+TEST(local_search, best_assignment) {
+    using namespace sat;
+    const auto [clauses, numVariables] = test::loadProblem(__EVAL_DATA_DIR__ "sat/hard/uf250-023.cnf");
+    LocalSearch localSearch(clauses, numVariables);
+    LocalSearch check(clauses, numVariables);
+    // the best assignment must stay consistent across several calls to search
+    for (unsigned i = 0; i < 3; ++i) {
+        localSearch.search(200);
+        check.setAssignment(localSearch.getBestAssignment());
+        EXPECT_EQ(check.numFalsified(), localSearch.numBestFalsified());
+        EXPECT_LE(localSearch.numBestFalsified(), localSearch.numFalsified());
+    }
+}
+
+TEST(local_search, solve_random_instances) {
+    using namespace sat;
+    for (const auto &file : {std::string(test::TestData::SatEasy1), std::string(test::TestData::SatEasy2),
+                             std::string(__EVAL_DATA_DIR__ "sat/hard/uf250-023.cnf")}) {
+        const auto [clauses, numVariables] = test::loadProblem(file);
+        LocalSearch localSearch(clauses, numVariables);
+        ASSERT_EQ(localSearch.search(10'000'000), SolveResult::Sat) << "no model found for " << file;
+        EXPECT_TRUE(test::isModel(clauses, localSearch.getAssignment())) << "invalid model for " << file;
+        EXPECT_EQ(localSearch.getAssignment(), localSearch.getBestAssignment());
+    }
+}
+
+TEST(local_search, initialize_phases) {
+    using namespace sat;
+    const auto [clauses, numVariables] = test::loadProblem(test::TestData::SatEasy1);
+    Solver solver(numVariables);
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(solver.addClause(Clause(clause)));
+    }
+
+    ASSERT_TRUE(initializePhases(solver, clauses, numVariables, 1'000'000));
+    ASSERT_EQ(solver.solve(), SolveResult::Sat);
+    // the first descent follows the model found by local search
+    EXPECT_EQ(solver.getStatistics().conflicts, 0u);
+    EXPECT_TRUE(test::isModel(clauses, solver.getModel()));
+}
+
+#ifndef __RUN_ALL_TESTS__
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
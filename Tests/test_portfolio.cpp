@@ -0,0 +1,69 @@
+/**
+* @date 16.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <set>
+
+#include "Portfolio.hpp"
+#include "testing_utils.hpp"
+
+TEST(portfolio, diversified_configs) {
+    using namespace sat;
+    const SolverConfig base;
+    const auto configs = makePortfolio(8, base);
+    ASSERT_EQ(configs.size(), 8u);
+    EXPECT_EQ(configs.front().seed, base.seed);
+    EXPECT_EQ(configs.front().heuristic, base.heuristic);
+    EXPECT_EQ(configs.front().restarts, base.restarts);
+    std::set<unsigned> seeds;
+    for (const auto &config : configs) {
+        seeds.insert(config.seed);
+    }
+
+    EXPECT_EQ(seeds.size(), configs.size());
+    EXPECT_EQ(configs[1].heuristic, BranchingStrategy::VMTF);
+    EXPECT_EQ(configs[2].restarts, RestartStrategy::Luby);
+    EXPECT_TRUE(configs[4].randomPhases);
+}
+
+void expectPortfolioResult(const std::string &cnfFile, sat::SolveResult expected, unsigned numWorkers) {
+    using namespace sat;
+    const auto [clauses, numVariables] = test::loadProblem(cnfFile);
+    const auto outcome = solvePortfolio(clauses, numVariables, makePortfolio(numWorkers));
+    ASSERT_EQ(outcome.result, expected) << "wrong result for " << cnfFile;
+    EXPECT_LT(outcome.winner, numWorkers);
+    if (expected == SolveResult::Sat) {
+        EXPECT_TRUE(test::isModel(clauses, outcome.model)) << "invalid model for " << cnfFile;
+    }
+}
+
+TEST(portfolio, solve) {
+    using namespace sat;
+    for (unsigned numWorkers : {1u, 4u}) {
+        expectPortfolioResult(test::TestData::SatMedium, SolveResult::Sat, numWorkers);
+        expectPortfolioResult(test::TestData::UnsatEasy1, SolveResult::Unsat, numWorkers);
+        expectPortfolioResult(test::TestData::UnsatPigeonHole, SolveResult::Unsat, numWorkers);
+    }
+}
+
+TEST(portfolio, cancel) {
+    using namespace sat;
+    const auto [clauses, numVariables] = test::loadProblem(test::TestData::UnsatPigeonHole);
+    std::stop_source stop;
+    stop.request_stop();
+    const auto outcome = solvePortfolio(clauses, numVariables, makePortfolio(4), stop.get_token());
+    EXPECT_EQ(outcome.result, SolveResult::Unknown);
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
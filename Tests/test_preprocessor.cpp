@@ -0,0 +1,160 @@
+/**
+* @date 16.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "Preprocessor.hpp"
+#include "Solver.hpp"
+#include "testing_utils.hpp"
+
+TEST(preprocessor, eliminate_variable) {
+    using namespace sat;
+    Preprocessor pre(4);
+    ASSERT_TRUE(pre.addClause({pos(0), pos(1)}));
+    ASSERT_TRUE(pre.addClause({neg(0), pos(2)}));
+    ASSERT_TRUE(pre.addClause({neg(0), pos(3)}));
+    pre.freeze(1);
+    pre.freeze(2);
+    pre.freeze(3);
+    ASSERT_TRUE(pre.eliminate());
+    EXPECT_TRUE(pre.isEliminated(0));
+    EXPECT_FALSE(pre.isEliminated(1));
+    const auto clauses = pre.getClauses();
+    EXPECT_EQ(clauses.size(), 2u);
+    EXPECT_TRUE(test::findClause(std::vector{pos(1), pos(2)}, clauses));
+    EXPECT_TRUE(test::findClause(std::vector{pos(1), pos(3)}, clauses));
+
+    std::vector model{TruthValue::Undefined, TruthValue::False, TruthValue::True, TruthValue::True};
+    pre.extend(model);
+    EXPECT_EQ(model[0], TruthValue::True);
+    model = {TruthValue::True, TruthValue::True, TruthValue::False, TruthValue::True};
+    pre.extend(model);
+    EXPECT_EQ(model[0], TruthValue::False);
+}
+
+TEST(preprocessor, units) {
+    using namespace sat;
+    Preprocessor pre(3);
+    ASSERT_TRUE(pre.addClause({pos(0)}));
+    ASSERT_TRUE(pre.addClause({neg(0), pos(1), pos(2)}));
+    ASSERT_TRUE(pre.addClause({neg(0), neg(1)}));
+    ASSERT_TRUE(pre.addClause({pos(0), neg(2)}));
+    ASSERT_TRUE(pre.eliminate());
+    EXPECT_TRUE(test::findClause(std::vector{pos(0)}, pre.getClauses()));
+    EXPECT_TRUE(test::findClause(std::vector{neg(1)}, pre.getClauses()));
+    EXPECT_TRUE(test::findClause(std::vector{pos(2)}, pre.getClauses()));
+    EXPECT_FALSE(pre.addClause({neg(2)}));
+    EXPECT_EQ(pre.getClauses().size(), 1u);
+    EXPECT_TRUE(pre.getClauses().front().empty());
+}
+
+TEST(preprocessor, subsumption) {
+    using namespace sat;
+    Preprocessor pre(5);
+    ASSERT_TRUE(pre.addClause({pos(0), pos(1)}));
+    ASSERT_TRUE(pre.addClause({pos(0), pos(1), pos(2)}));
+    ASSERT_TRUE(pre.addClause({neg(0), pos(1), pos(3)}));
+    ASSERT_TRUE(pre.addClause({pos(0), pos(2), pos(4)}));
+    for (unsigned varId = 0; varId < 5; ++varId) {
+        pre.freeze(varId);
+    }
+
+    ASSERT_TRUE(pre.eliminate());
+    const auto clauses = pre.getClauses();
+    EXPECT_EQ(pre.getStatistics().subsumedClauses, 1u);
+    EXPECT_EQ(pre.getStatistics().strengthenedClauses, 1u);
+    EXPECT_EQ(clauses.size(), 3u);
+    EXPECT_TRUE(test::findClause(std::vector{pos(0), pos(1)}, clauses));
+    EXPECT_TRUE(test::findClause(std::vector{pos(1), pos(3)}, clauses));
+    EXPECT_TRUE(test::findClause(std::vector{pos(0), pos(2), pos(4)}, clauses));
+}
+
+TEST(preprocessor, blocked_clauses) {
+    using namespace sat;
+    Preprocessor pre(2);
+    ASSERT_TRUE(pre.addClause({pos(0), pos(1)}));
+    ASSERT_TRUE(pre.addClause({neg(0), neg(1)}));
+    pre.freeze(1);
+    ASSERT_TRUE(pre.eliminate());
+    EXPECT_EQ(pre.getStatistics().blockedClauses, 2u);
+    EXPECT_TRUE(pre.getClauses().empty());
+
+    std::vector model{TruthValue::False, TruthValue::False};
+    pre.extend(model);
+    EXPECT_EQ(model[0], TruthValue::True);
+    model = {TruthValue::True, TruthValue::True};
+    pre.extend(model);
+    EXPECT_EQ(model[0], TruthValue::False);
+}
+
+TEST(preprocessor, blocked_clauses_step_limit) {
+    using namespace sat;
+    Preprocessor pre(2, 0);
+    ASSERT_TRUE(pre.addClause({pos(0), pos(1)}));
+    ASSERT_TRUE(pre.addClause({neg(0), neg(1)}));
+    pre.freeze(0);
+    pre.freeze(1);
+    ASSERT_TRUE(pre.eliminate());
+    EXPECT_EQ(pre.getStatistics().blockedClauses, 0u);
+    EXPECT_EQ(pre.getClauses().size(), 2u);
+}
+
+TEST(preprocessor, stop) {
+    using namespace sat;
+    Preprocessor pre(4);
+    ASSERT_TRUE(pre.addClause({pos(0), pos(1)}));
+    ASSERT_TRUE(pre.addClause({neg(0), pos(2)}));
+    ASSERT_TRUE(pre.addClause({neg(0), pos(3)}));
+    ASSERT_TRUE(pre.addClause({pos(0), pos(1), pos(2)}));
+    std::stop_source stop;
+    stop.request_stop();
+    pre.setStopToken(stop.get_token());
+    ASSERT_TRUE(pre.eliminate());
+    EXPECT_FALSE(pre.isEliminated(0));
+    EXPECT_EQ(pre.getStatistics().subsumedClauses, 0u);
+    EXPECT_EQ(pre.getStatistics().blockedClauses, 0u);
+    EXPECT_EQ(pre.getClauses().size(), 4u);
+}
+
+void expectPreprocessedResult(const std::string &cnfFile, sat::SolveResult expected) {
+    using namespace sat;
+    auto [clauses, numVariables] = test::loadProblem(cnfFile);
+    Preprocessor pre(numVariables);
+    for (const auto &clause : clauses) {
+        pre.addClause(clause);
+    }
+
+    pre.eliminate();
+    Solver s(numVariables);
+    for (const auto &clause : pre.getClauses()) {
+        s.addClause(Clause(clause));
+    }
+
+    ASSERT_EQ(s.solve(), expected) << "wrong result for " << cnfFile;
+    if (expected == SolveResult::Sat) {
+        auto model = s.getModel();
+        pre.extend(model);
+        EXPECT_TRUE(test::isModel(clauses, model)) << "invalid model for " << cnfFile;
+    }
+}
+
+TEST(preprocessor, solve_preprocessed) {
+    using namespace sat;
+    expectPreprocessedResult(test::TestData::SatEasy1, SolveResult::Sat);
+    expectPreprocessedResult(test::TestData::SatMedium, SolveResult::Sat);
+    expectPreprocessedResult(test::TestData::UnsatEasy1, SolveResult::Unsat);
+    expectPreprocessedResult(test::TestData::UnsatPigeonHole, SolveResult::Unsat);
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
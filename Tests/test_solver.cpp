@@ -104,6 +104,53 @@ TEST(solver, unit_propagation_complex) {
     EXPECT_TRUE(s.unitPropagate()) << "unit propagation failed";
 }
 
+TEST(solver, decision_levels) {
+    using namespace sat;
+    auto clauses = {Clause({neg(1), pos(0), neg(2)}), Clause({neg(1), pos(2)}), Clause({neg(0), neg(3)})};
+    Solver s(4);
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(clause));
+    }
+
+    ASSERT_TRUE(s.assign(pos(3)));
+    ASSERT_TRUE(s.unitPropagate());
+    EXPECT_EQ(s.currentLevel(), 0u);
+    EXPECT_EQ(s.level(3), 0u);
+    EXPECT_EQ(s.val(0), TruthValue::False);
+    EXPECT_NE(s.reason(0), Solver::NoReason);
+    EXPECT_EQ(s.reason(3), Solver::NoReason);
+
+    s.newDecisionLevel();
+    ASSERT_TRUE(s.assign(pos(1)));
+    EXPECT_FALSE(s.unitPropagate()) << "unit propagation succeeded but it shouldn't have!";
+    EXPECT_EQ(s.currentLevel(), 1u);
+    EXPECT_EQ(s.level(1), 1u);
+}
+
+TEST(solver, backtrack) {
+    using namespace sat;
+    auto clauses = {Clause({neg(1), pos(0), neg(2)}), Clause({neg(1), pos(2)}), Clause({neg(0), neg(3)})};
+    Solver s(4);
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(clause));
+    }
+
+    ASSERT_TRUE(s.assign(pos(3)));
+    ASSERT_TRUE(s.unitPropagate());
+    s.newDecisionLevel();
+    ASSERT_TRUE(s.assign(pos(1)));
+    EXPECT_FALSE(s.unitPropagate());
+    s.backtrack(0);
+    EXPECT_EQ(s.currentLevel(), 0u);
+    EXPECT_EQ(s.val(1), TruthValue::Undefined);
+    EXPECT_EQ(s.val(2), TruthValue::Undefined);
+    EXPECT_EQ(s.val(3), TruthValue::True);
+    EXPECT_EQ(s.val(0), TruthValue::False);
+
+    s.newDecisionLevel();
+    ASSERT_TRUE(s.assign(neg(1)));
+    EXPECT_TRUE(s.unitPropagate()) << "unit propagation failed after backtracking";
+}
 
 TEST(solver, rebase) {
     using namespace sat;
@@ -115,13 +162,526 @@ TEST(solver, rebase) {
 
     ASSERT_TRUE(s.assign(pos(0)));
     const auto rebased = s.rebase();
-    EXPECT_EQ(rebased.size(), 3);
+    EXPECT_EQ(rebased.size(), 3u);
     EXPECT_TRUE(test::findClause(Clause({pos(0)}), rebased)) << "Clause " << Clause({pos(0)}) << " was not found";
     EXPECT_TRUE(test::findClause(Clause({neg(2)}), rebased)) << "Clause " << Clause({neg(2)}) << " was not found";
     EXPECT_TRUE(test::findClause(Clause({neg(1), pos(2)}), rebased))
         << "Clause " << Clause({neg(1), pos(2)}) << " was not found";
 }
 
+TEST(solver, solve_trivial) {
+    using namespace sat;
+    auto clauses = {Clause({neg(1), pos(0), neg(2)}), Clause({neg(1), pos(2)}), Clause({neg(0), neg(2)})};
+    Solver s(3);
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(clause));
+    }
+
+    ASSERT_EQ(s.solve(), SolveResult::Sat);
+    EXPECT_TRUE(test::isModel(std::vector(clauses), s.getModel()));
+}
+
+TEST(solver, stop_without_conflicts) {
+    using namespace sat;
+    Solver s(3);
+    ASSERT_TRUE(s.addClause(Clause({neg(1), pos(0), neg(2)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(1), pos(2)})));
+    std::stop_source stop;
+    stop.request_stop();
+    s.setStopToken(stop.get_token());
+    // the search would never hit a conflict, the stop token must be checked before decisions
+    ASSERT_EQ(s.solve(), SolveResult::Unknown);
+    EXPECT_EQ(s.getStatistics().decisions, 0u);
+    s.setStopToken({});
+    EXPECT_EQ(s.solve(), SolveResult::Sat);
+}
+
+TEST(solver, solve_empty_clause) {
+    using namespace sat;
+    Solver s(3);
+    EXPECT_FALSE(s.addClause(Clause()));
+    EXPECT_EQ(s.solve(), SolveResult::Unsat);
+}
+
+void expectSolveResult(const std::string &cnfFile, sat::SolveResult expected,
+                       sat::RestartStrategy restarts = sat::RestartStrategy::Glucose,
+                       unsigned chronoThreshold = std::numeric_limits<unsigned>::max()) {
+    using namespace sat;
+    auto [clauses, numVariables] = test::loadProblem(cnfFile);
+    Solver s(numVariables);
+    s.setRestartPolicy(makeRestartPolicy(restarts));
+    s.setChronoThreshold(chronoThreshold);
+    for (const auto &clause : clauses) {
+        s.addClause(Clause(clause));
+    }
+
+    ASSERT_EQ(s.solve(), expected) << "wrong result for " << cnfFile;
+    if (expected == SolveResult::Sat) {
+        EXPECT_TRUE(test::isModel(clauses, s.getModel())) << "invalid model for " << cnfFile;
+    }
+}
+
+TEST(solver, solve_sat) {
+    using namespace sat;
+    expectSolveResult(test::TestData::SatEasy1, SolveResult::Sat);
+    expectSolveResult(test::TestData::SatEasy2, SolveResult::Sat);
+    expectSolveResult(test::TestData::SatMedium, SolveResult::Sat);
+}
+
+TEST(solver, solve_unsat) {
+    using namespace sat;
+    expectSolveResult(test::TestData::UnsatEasy1, SolveResult::Unsat);
+    expectSolveResult(test::TestData::UnsatEasy2, SolveResult::Unsat);
+    expectSolveResult(test::TestData::UnsatPigeonHole, SolveResult::Unsat);
+}
+
+TEST(solver, solve_restart_strategies) {
+    using namespace sat;
+    for (auto restarts : {RestartStrategy::None, RestartStrategy::Luby}) {
+        expectSolveResult(test::TestData::SatMedium, SolveResult::Sat, restarts);
+        expectSolveResult(test::TestData::UnsatPigeonHole, SolveResult::Unsat, restarts);
+    }
+}
+
+TEST(solver, solve_chronological_backtracking) {
+    using namespace sat;
+    for (unsigned threshold : {0u, 3u}) {
+        expectSolveResult(test::TestData::SatEasy1, SolveResult::Sat, RestartStrategy::Glucose, threshold);
+        expectSolveResult(test::TestData::SatMedium, SolveResult::Sat, RestartStrategy::Glucose, threshold);
+        expectSolveResult(test::TestData::UnsatEasy1, SolveResult::Unsat, RestartStrategy::Glucose, threshold);
+        expectSolveResult(test::TestData::UnsatPigeonHole, SolveResult::Unsat, RestartStrategy::Glucose, threshold);
+    }
+}
+
+TEST(solver, reduce_and_compact_learnts) {
+    using namespace sat;
+    auto [clauses, numVariables] = test::loadProblem(test::TestData::UnsatPigeonHole);
+    Solver s(numVariables);
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(Clause(clause)));
+    }
+
+    // stop at the first conflict after a compacting reduction, remembering the database just before that reduction
+    std::stop_source stop;
+    s.setStopToken(stop.get_token());
+    std::size_t learntsBefore = 0;
+    std::size_t coreBefore = 0;
+    auto handle = s.getEvents().conflict.subscribe_handled([&](std::span<const Variable>) {
+        if (s.getStatistics().compactions == 0) {
+            learntsBefore = s.numLearnts();
+            coreBefore = s.numLearnts(ClauseTier::Core);
+        } else {
+            stop.request_stop();
+        }
+    });
+
+    ASSERT_EQ(s.solve(), SolveResult::Unknown);
+    const auto &stats = s.getStatistics();
+    EXPECT_GT(stats.reductions, 0u);
+    EXPECT_GT(stats.compactions, 0u);
+    EXPECT_GT(stats.deletedClauses, 0u);
+    EXPECT_GT(coreBefore, 0u);
+    EXPECT_LT(s.numLearnts(), learntsBefore);
+    EXPECT_GE(s.numLearnts(ClauseTier::Core), coreBefore);
+    s.setStopToken({});
+    EXPECT_EQ(s.solve(), SolveResult::Unsat);
+}
+
+TEST(solver, solve_assumptions) {
+    using namespace sat;
+    Solver s(5);
+    ASSERT_TRUE(s.addClause(Clause({neg(0), pos(1)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(1), pos(2)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(3), neg(2)})));
+    ASSERT_EQ(s.solve({pos(0), pos(4), pos(3)}), SolveResult::Unsat);
+    EXPECT_THAT(s.getCore(), testing::UnorderedElementsAre(pos(0), pos(3)));
+    ASSERT_EQ(s.solve({pos(0)}), SolveResult::Sat);
+    EXPECT_EQ(s.val(2), TruthValue::True);
+    EXPECT_EQ(s.val(3), TruthValue::False);
+    EXPECT_TRUE(s.getCore().empty());
+    ASSERT_EQ(s.solve({pos(4), neg(4)}), SolveResult::Unsat);
+    EXPECT_THAT(s.getCore(), testing::UnorderedElementsAre(pos(4), neg(4)));
+    ASSERT_TRUE(s.addClause(Clause({neg(0)})));
+    ASSERT_EQ(s.solve({pos(0), pos(3)}), SolveResult::Unsat);
+    EXPECT_THAT(s.getCore(), testing::ElementsAre(pos(0)));
+    ASSERT_EQ(s.solve(), SolveResult::Sat);
+    EXPECT_EQ(s.val(0), TruthValue::False);
+}
+
+TEST(solver, solve_repeated_assumptions) {
+    using namespace sat;
+    Solver s(4);
+    for (unsigned mask = 0; mask < 8; ++mask) {
+        ASSERT_TRUE(s.addClause(Clause({mask & 1 ? neg(0) : pos(0), mask & 2 ? neg(1) : pos(1),
+                                        mask & 4 ? neg(2) : pos(2)})));
+    }
+
+    // every assumption opens a level, so repeated assumptions push the level past the number of variables
+    ASSERT_EQ(s.solve(std::vector<Literal>(6, pos(0))), SolveResult::Unsat);
+    EXPECT_THAT(s.getCore(), testing::ElementsAre(pos(0)));
+    ASSERT_TRUE(s.addClause(Clause({neg(3), pos(0)})));
+    ASSERT_EQ(s.solve({pos(3), pos(0), pos(3), pos(0), pos(3), pos(0)}), SolveResult::Unsat);
+    EXPECT_THAT(s.getCore(), testing::Each(testing::AnyOf(pos(0), pos(3))));
+    EXPECT_FALSE(s.getCore().empty());
+}
+
+TEST(solver, solve_implied_assumptions) {
+    using namespace sat;
+    Solver s(6);
+    ASSERT_TRUE(s.addClause(Clause({neg(0), pos(1)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(1), pos(2)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(2), pos(3)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(3), neg(4)})));
+    const std::vector<Literal> implied{pos(0), pos(1), pos(2), pos(3), pos(1), pos(2), pos(3), pos(0)};
+    ASSERT_EQ(s.solve(implied), SolveResult::Sat);
+    EXPECT_EQ(s.val(3), TruthValue::True);
+    EXPECT_EQ(s.val(4), TruthValue::False);
+    EXPECT_TRUE(s.getCore().empty());
+    auto conflicting = implied;
+    conflicting.emplace_back(pos(4));
+    ASSERT_EQ(s.solve(conflicting), SolveResult::Unsat);
+    EXPECT_THAT(s.getCore(), testing::Contains(pos(4)));
+    EXPECT_THAT(s.getCore(), testing::Each(testing::AnyOf(pos(0), pos(1), pos(2), pos(3), pos(4))));
+}
+
+TEST(solver, solve_incremental) {
+    using namespace sat;
+    auto [clauses, numVariables] = test::loadProblem(test::TestData::SatMedium);
+    Solver s(numVariables);
+    for (const auto &clause : clauses) {
+        s.addClause(Clause(clause));
+    }
+
+    ASSERT_EQ(s.solve(), SolveResult::Sat);
+    const auto model = s.getModel();
+    // forbid the model found in the first call, the solver must find a different one or prove there is none
+    std::vector<Literal> blocking;
+    std::vector<Literal> assumptions;
+    for (unsigned varId = 0; varId < numVariables; ++varId) {
+        blocking.emplace_back(model[varId] == TruthValue::True ? neg(varId) : pos(varId));
+        assumptions.emplace_back(model[varId] == TruthValue::True ? pos(varId) : neg(varId));
+    }
+
+    ASSERT_EQ(s.solve(assumptions), SolveResult::Sat);
+    EXPECT_EQ(s.getModel(), model);
+    ASSERT_TRUE(s.addClause(Clause(blocking)));
+    ASSERT_EQ(s.solve(assumptions), SolveResult::Unsat);
+    EXPECT_FALSE(s.getCore().empty());
+    const auto result = s.solve();
+    if (result == SolveResult::Sat) {
+        EXPECT_TRUE(test::isModel(clauses, s.getModel()));
+        EXPECT_NE(s.getModel(), model);
+    }
+}
+
+TEST(solver, failed_literal_probing) {
+    using namespace sat;
+    Solver s(4);
+    ASSERT_TRUE(s.addClause(Clause({neg(0), pos(1)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(0), pos(2)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(1), neg(2)})));
+    ASSERT_TRUE(s.addClause(Clause({pos(0), pos(3), pos(1)})));
+    ASSERT_EQ(s.solve(), SolveResult::Sat);
+    EXPECT_GE(s.getStatistics().failedLiterals, 1u);
+    EXPECT_EQ(s.val(0), TruthValue::False);
+    EXPECT_EQ(s.level(0), 0u);
+}
+
+TEST(solver, equivalent_literal_substitution) {
+    using namespace sat;
+    const std::vector<std::vector<Literal>> clauses{
+        {neg(0), pos(1)}, {neg(1), neg(2)}, {pos(2), pos(0)}, // x0 -> x1 -> ~x2 -> x0
+        {pos(0), pos(3), pos(4)}, {neg(1), neg(3), pos(4)}, {pos(2), neg(4), pos(3)}, {neg(0), neg(3), neg(4)}};
+    Solver s(5);
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(Clause(clause)));
+    }
+
+    ASSERT_EQ(s.solve(), SolveResult::Sat);
+    EXPECT_EQ(s.getStatistics().substitutedVariables, 2u);
+    EXPECT_TRUE(test::isModel(clauses, s.getModel()));
+    // substituted variables are no decision variables, they are parked on level 0
+    const auto onLevel0 = std::ranges::count_if(std::vector{0u, 1u, 2u}, [&s](unsigned varId) {
+        return s.level(varId) == 0;
+    });
+    EXPECT_EQ(onLevel0, 2);
+    // assumptions on substituted variables are mapped to their representative, the core names the assumptions
+    ASSERT_EQ(s.solve({pos(0), pos(2)}), SolveResult::Unsat);
+    EXPECT_THAT(s.getCore(), testing::UnorderedElementsAre(pos(0), pos(2)));
+    ASSERT_EQ(s.solve({pos(1), neg(2)}), SolveResult::Sat);
+    EXPECT_TRUE(test::isModel(clauses, s.getModel()));
+    EXPECT_EQ(s.getStatistics().substitutedVariables, 2u);
+
+    ASSERT_TRUE(s.addClause(Clause({neg(0), pos(2)})));
+    ASSERT_EQ(s.solve(), SolveResult::Sat);
+    EXPECT_EQ(s.val(0), TruthValue::False);
+    s.addClause(Clause({pos(0), pos(1)}));
+    EXPECT_EQ(s.solve(), SolveResult::Unsat);
+}
+
+TEST(solver, learned_clause_minimization) {
+    using namespace sat;
+    auto [clauses, numVariables] = test::loadProblem(test::TestData::UnsatPigeonHole);
+    Solver s(numVariables);
+    for (auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(Clause(std::move(clause))));
+    }
+
+    ASSERT_EQ(s.solve(), SolveResult::Unsat);
+    EXPECT_GT(s.getStatistics().minimizedLiterals, 0u);
+}
+
+TEST(solver, learned_clause_strengthening_to_unit) {
+    using namespace sat;
+    // 12 pigeons in 11 holes, guarded by g, so that the search runs until learned clauses are subsumed
+    constexpr unsigned Holes = 11;
+    constexpr unsigned NumPigeonVars = (Holes + 1) * Holes;
+    const unsigned g = NumPigeonVars;
+    const unsigned y0 = g + 1, y1 = g + 2, y2 = g + 3, y3 = g + 4, z = g + 5;
+    Solver s(NumPigeonVars + 6);
+    // the gadget variables have the highest indices => never decided while the guarded pigeon clauses are open
+    s.setHeuristic(FirstVariable{});
+    for (unsigned pigeon = 0; pigeon <= Holes; ++pigeon) {
+        std::vector<Literal> somewhere{neg(g)};
+        for (unsigned hole = 0; hole < Holes; ++hole) {
+            somewhere.emplace_back(pos(pigeon * Holes + hole));
+            for (unsigned other = 0; other < pigeon; ++other) {
+                ASSERT_TRUE(s.addClause(Clause({neg(pigeon * Holes + hole), neg(other * Holes + hole), neg(g)})));
+            }
+        }
+
+        ASSERT_TRUE(s.addClause(Clause(std::move(somewhere))));
+    }
+
+    // y0 is implied and y0 -> y2 -> y3 -> ~y0 => unsatisfiable. The binary clauses are only implied by resolution on z
+    // and are passed to the solver as imported learned clauses
+    const std::vector<std::vector<Literal>> binaries{
+        {pos(y0), pos(y1)}, {pos(y0), neg(y1)}, {neg(y0), pos(y2)}, {neg(y2), pos(y3)}, {neg(y3), neg(y0)}};
+    for (const auto &binary : binaries) {
+        for (Literal l : {pos(z), neg(z)}) {
+            ASSERT_TRUE(s.addClause(Clause({binary[0], binary[1], l})));
+        }
+    }
+
+    // (y0 | ~y1) is strengthened by (y0 | y1) to the unit y0, whose propagation leads to a conflict
+    auto imports = binaries;
+    s.setClauseSharing({.importClause = [&imports](std::vector<Literal> &literals, unsigned &lbd) {
+        if (imports.empty()) {
+            return false;
+        }
+
+        literals = imports.back();
+        lbd = 2;
+        imports.pop_back();
+        return true;
+    }});
+
+    // the unit must be propagated by the subsumption round itself. A refutation by a later conflict on level 0 would
+    // count one more conflict than the last one passed to the conflict event
+    std::size_t analyzedConflicts = 0;
+    auto handle = s.getEvents().conflict.subscribe_handled([&](std::span<const Variable>) {
+        analyzedConflicts = s.getStatistics().conflicts;
+    });
+
+    ASSERT_EQ(s.solve({pos(g)}), SolveResult::Unsat);
+    EXPECT_GT(s.getStatistics().strengthenedClauses, 0u);
+    EXPECT_TRUE(s.getCore().empty());
+    EXPECT_EQ(s.getStatistics().conflicts, analyzedConflicts);
+    EXPECT_EQ(s.solve(), SolveResult::Unsat);
+}
+
+TEST(solver, learned_clause_vivification) {
+    using namespace sat;
+    auto [clauses, numVariables] = test::loadProblem(test::TestData::UnsatPigeonHole);
+    Solver s(numVariables);
+    for (auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(Clause(std::move(clause))));
+    }
+
+    ASSERT_EQ(s.solve(), SolveResult::Unsat);
+    EXPECT_GT(s.getStatistics().vivifiedClauses, 0u);
+    EXPECT_GE(s.getStatistics().vivifiedLiterals, s.getStatistics().vivifiedClauses);
+}
+
+TEST(solver, phase_saving) {
+    using namespace sat;
+    Solver s(4);
+    ASSERT_TRUE(s.addClause(Clause({pos(0), pos(1), pos(2)})));
+    EXPECT_EQ(s.getPhases(), std::vector(4, TruthValue::False));
+    s.newDecisionLevel();
+    ASSERT_TRUE(s.assign(pos(3)));
+    s.newDecisionLevel();
+    ASSERT_TRUE(s.assign(neg(1)));
+    s.backtrack(0);
+    const std::vector expected{TruthValue::False, TruthValue::False, TruthValue::False, TruthValue::True};
+    EXPECT_EQ(s.getPhases(), expected);
+    // x3 is unconstrained and keeps its saved phase
+    ASSERT_EQ(s.solve(), SolveResult::Sat);
+    EXPECT_EQ(s.val(3), TruthValue::True);
+    s.backtrack(0);
+    s.setPhases({TruthValue::Undefined, TruthValue::Undefined, TruthValue::Undefined, TruthValue::False});
+    ASSERT_EQ(s.solve(), SolveResult::Sat);
+    EXPECT_EQ(s.val(3), TruthValue::False);
+}
+
+TEST(solver, set_phases_after_search) {
+    using namespace sat;
+    auto [clauses, numVariables] = test::loadProblem(test::TestData::SatMedium);
+    Solver s(numVariables);
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(Clause(clause)));
+    }
+
+    ASSERT_EQ(s.solve(), SolveResult::Sat);
+    ASSERT_GT(s.getStatistics().conflicts, 0u);
+    // the search left target phases behind, they must not hide the new phases
+    std::vector<TruthValue> phases;
+    for (unsigned varId = 0; varId < numVariables; ++varId) {
+        phases.emplace_back(s.val(varId) == TruthValue::True ? TruthValue::False : TruthValue::True);
+    }
+
+    s.backtrack(0);
+    s.setPhases(phases);
+    EXPECT_EQ(s.getPhases(), phases);
+    ASSERT_EQ(s.solve(), SolveResult::Sat);
+    EXPECT_TRUE(test::isModel(clauses, s.getModel()));
+}
+
+TEST(solver, rephase_cycle) {
+    using namespace sat;
+    Solver s(4);
+    s.setPhases({TruthValue::True, TruthValue::False, TruthValue::True, TruthValue::False});
+    const std::vector allFalse(4, TruthValue::False);
+    const std::vector allTrue(4, TruthValue::True);
+    // no best phases are known, so the best phase steps keep the current phases
+    for (const auto &expected : {allFalse, allFalse, allTrue, allTrue}) {
+        s.rephase();
+        EXPECT_EQ(s.getPhases(), expected);
+    }
+
+    s.rephase();
+    s.rephase();
+    s.rephase();
+    EXPECT_EQ(s.getPhases(), allFalse);
+    EXPECT_EQ(s.getStatistics().rephases, 7u);
+}
+
+TEST(solver, rephase_schedule) {
+    using namespace sat;
+    auto [clauses, numVariables] = test::loadProblem(test::TestData::UnsatPigeonHole);
+    Solver s(numVariables);
+    for (auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(Clause(std::move(clause))));
+    }
+
+    ASSERT_EQ(s.solve(), SolveResult::Unsat);
+    // the first rephase happens after 1000 conflicts, rephase k at least 1000 * (k + 1) conflicts after rephase k - 1
+    std::size_t maxRephases = 0;
+    std::size_t threshold = 1000;
+    while (threshold <= s.getStatistics().conflicts) {
+        ++maxRephases;
+        threshold += 1000 * (maxRephases + 1);
+    }
+
+    EXPECT_GT(s.getStatistics().rephases, 0u);
+    EXPECT_LE(s.getStatistics().rephases, maxRephases);
+}
+
+TEST(solver, evsids) {
+    using namespace sat;
+    SearchEvents events;
+    EVSIDS heuristic(4, events);
+    std::vector<TruthValue> model(4, TruthValue::Undefined);
+    const std::vector<Variable> first{2, 1};
+    const std::vector<Variable> second{1, 3};
+    events.conflict.trigger(std::span<const Variable>(first));
+    events.conflict.trigger(std::span<const Variable>(second));
+    EXPECT_GT(heuristic.getActivity(3), heuristic.getActivity(2));
+    EXPECT_EQ(heuristic(model, 4), Variable(1));
+    model[1] = TruthValue::True;
+    model[3] = TruthValue::False;
+    EXPECT_EQ(heuristic(model, 2), Variable(2));
+    model[2] = TruthValue::True;
+    model[1] = TruthValue::Undefined;
+    events.unassign.trigger(Variable(1));
+    EXPECT_EQ(heuristic(model, 2), Variable(1));
+}
+
+TEST(solver, vmtf) {
+    using namespace sat;
+    SearchEvents events;
+    VMTF heuristic(4, events);
+    std::vector<TruthValue> model(4, TruthValue::Undefined);
+    EXPECT_EQ(heuristic(model, 4), Variable(3));
+    model[3] = TruthValue::True;
+    EXPECT_EQ(heuristic(model, 3), Variable(2));
+    model[2] = TruthValue::True;
+    model[0] = TruthValue::False;
+    const std::vector<Variable> bumped{0, 2};
+    events.conflict.trigger(std::span<const Variable>(bumped));
+    EXPECT_EQ(heuristic(model, 1), Variable(1));
+    model[0] = TruthValue::Undefined;
+    events.unassign.trigger(Variable(0));
+    EXPECT_EQ(heuristic(model, 2), Variable(0));
+    model[2] = TruthValue::Undefined;
+    events.unassign.trigger(Variable(2));
+    EXPECT_EQ(heuristic(model, 3), Variable(2));
+}
+
+TEST(solver, assign_events) {
+    using namespace sat;
+    Solver s(3);
+    EXPECT_FALSE(s.getEvents().assign.hasSubscribers());
+    std::vector<Variable> assigned;
+    {
+        auto handle = s.getEvents().assign.subscribe_handled([&assigned](Variable x) { assigned.emplace_back(x); });
+        EXPECT_TRUE(s.getEvents().assign.hasSubscribers());
+        ASSERT_TRUE(s.assign(pos(1)));
+        ASSERT_TRUE(s.assign(neg(2)));
+        EXPECT_EQ(assigned, (std::vector<Variable>{1, 2}));
+    }
+
+    ASSERT_TRUE(s.assign(pos(0)));
+    EXPECT_EQ(assigned.size(), 2u);
+    EXPECT_FALSE(s.getEvents().assign.hasSubscribers());
+}
+
+TEST(solver, solve_branching_strategies) {
+    using namespace sat;
+    for (auto branching : {BranchingStrategy::VMTF, BranchingStrategy::FirstVariable}) {
+        auto [clauses, numVariables] = test::loadProblem(test::TestData::SatMedium);
+        Solver s(numVariables);
+        s.setHeuristic(makeHeuristic(branching, numVariables, s.getEvents()));
+        for (const auto &clause : clauses) {
+            s.addClause(Clause(clause));
+        }
+
+        ASSERT_EQ(s.solve(), SolveResult::Sat) << "wrong result for " << branching;
+        EXPECT_TRUE(test::isModel(clauses, s.getModel()));
+    }
+}
+
+TEST(solver, luby_sequence) {
+    using namespace sat;
+    const std::vector<std::size_t> expected{1, 1, 2, 1, 1, 2, 4, 1, 1, 2, 1, 1, 2, 4, 8, 1};
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(LubyRestarts::luby(i + 1), expected[i]);
+    }
+
+    LubyRestarts restarts(2);
+    std::vector<std::size_t> intervals;
+    std::size_t conflicts = 0;
+    while (intervals.size() < 7) {
+        ++conflicts;
+        if (restarts(0)) {
+            intervals.emplace_back(conflicts);
+            conflicts = 0;
+        }
+    }
+
+    EXPECT_EQ(intervals, (std::vector<std::size_t>{2, 2, 4, 2, 2, 4, 8}));
+}
+
 #ifndef __RUN_ALL_TESTS__
 
 int main(int argc, char **argv) {
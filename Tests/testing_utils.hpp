@@ -8,10 +8,15 @@
 #define TESTING_UTILS_HPP
 
 #include <unordered_set>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
 
 #include "util/concepts.hpp"
 #include "basic_structures.hpp"
 #include "Clause.hpp"
+#include "inout.hpp"
 
 /**
  * @brief Namespace containing testing helpers
@@ -27,6 +32,12 @@ namespace test {
         static constexpr auto UnitPropagationSolution2 = __TEST_DATA_DIR__ "res2.cnf";
         static constexpr auto UnitPropagationSolution3 = __TEST_DATA_DIR__ "res3.cnf";
         static constexpr auto UnitPropagationSolution4 = __TEST_DATA_DIR__ "res4.cnf";
+        static constexpr auto SatEasy1 = __EVAL_DATA_DIR__ "sat/easy/uf20-0184.cnf";
+        static constexpr auto SatEasy2 = __EVAL_DATA_DIR__ "sat/easy/uf20-0593.cnf";
+        static constexpr auto SatMedium = __EVAL_DATA_DIR__ "sat/medium/bw_large.a.cnf";
+        static constexpr auto UnsatEasy1 = __EVAL_DATA_DIR__ "unsat/easy/uuf50-0413.cnf";
+        static constexpr auto UnsatEasy2 = __EVAL_DATA_DIR__ "unsat/easy/uuf50-0567.cnf";
+        static constexpr auto UnsatPigeonHole = __EVAL_DATA_DIR__ "unsat/hard/hole8.cnf";
     };
 
     template<typename T>
@@ -64,6 +75,37 @@ namespace test {
 
         return res != clauses.end();
     }
+
+    /**
+     * Reads the clauses of a dimacs file
+     * @param cnfFile path to the file
+     * @return pair (clauses, number of variables)
+     */
+    inline auto loadProblem(const std::string &cnfFile) {
+        std::ifstream ifs(cnfFile);
+        if (not ifs.is_open()) {
+            std::cerr << "Could not open file " << cnfFile  <<". This should never happen" << std::endl;
+            std::exit(1);
+        }
+
+        return sat::inout::read_from_dimacs(ifs);
+    }
+
+    /**
+     * Checks whether the given assignment satisfies all clauses
+     * @param clauses clauses to check
+     * @param model truth value per variable
+     * @return true if every clause contains a satisfied literal
+     */
+    template<sat::clause_like Cl>
+    bool isModel(const std::vector<Cl> &clauses, const std::vector<sat::TruthValue> &model) {
+        return std::ranges::all_of(clauses, [&model](const auto &clause) {
+            return std::ranges::any_of(clause, [&model](sat::Literal l) {
+                const auto value = model[sat::var(l).get()];
+                return value == (l.sign() > 0 ? sat::TruthValue::True : sat::TruthValue::False);
+            });
+        });
+    }
 }
 
 #endif //TESTING_UTILS_HPP
@@ -0,0 +1,179 @@
+/**
+* @date 16.10.26
+* @brief Command line entry point. Reads a problem in dimacs format, solves it and prints the result in the SAT
+* competition output format
+*/
+
+#include <iostream>
+#include <fstream>
+
+#include "Solver/Solver.hpp"
+#include "Solver/Portfolio.hpp"
+#include "Solver/CubeAndConquer.hpp"
+#include "Solver/BatchSolver.hpp"
+#include "Solver/Preprocessor.hpp"
+#include "Solver/inout.hpp"
+#include "Solver/util/cli.hpp"
+#include "Solver/util/Profiler.hpp"
+
+int main(int argc, char *argv[]) {
+    using namespace sat;
+    auto restarts = RestartStrategy::Glucose;
+    auto branching = BranchingStrategy::EVSIDS;
+    bool noPreprocessing = false;
+    std::size_t blockingSteps = Preprocessor::DefaultBlockingStepLimit;
+    int chronoThreshold = -1;
+    unsigned numThreads = 1;
+    unsigned cubeDepth = 0;
+    bool batch = false;
+    double timeLimit = 0;
+    std::size_t memoryLimit = 0;
+    std::size_t memoryBudget = 0;
+    std::size_t localSearchFlips = 0;
+    const auto file = cli::parse(argc, argv, cli::ValueArg("-restarts", restarts),
+                                 cli::ValueArg("-heuristic", branching), cli::Switch("-no-pre", noPreprocessing),
+                                 cli::ValueArg("-bce-steps", blockingSteps), cli::ValueArg("-chrono", chronoThreshold),
+                                 cli::ValueArg("-threads", numThreads), cli::ValueArg("-cubes", cubeDepth),
+                                 cli::Switch("-batch", batch), cli::ValueArg("-time-limit", timeLimit),
+                                 cli::ValueArg("-mem-limit", memoryLimit), cli::ValueArg("-mem-budget", memoryBudget),
+                                 cli::ValueArg("-ls", localSearchFlips));
+    SolverConfig base{.heuristic = branching, .restarts = restarts, .localSearchFlips = localSearchFlips};
+    if (chronoThreshold >= 0) {
+        base.chronoThreshold = static_cast<unsigned>(chronoThreshold);
+    }
+
+    if (batch) {
+        // file is a directory or a list of instances. Limits are given in seconds and megabytes, 0 means no limit
+        constexpr std::size_t MegaByte = 1 << 20;
+        BatchOptions options{.numThreads = std::max(numThreads, 1u), .preprocessing = not noPreprocessing,
+                             .blockingStepLimit = blockingSteps, .config = base};
+        if (timeLimit > 0) {
+            options.timeLimit = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::duration<double>(timeLimit));
+        }
+
+        if (memoryLimit > 0) {
+            options.memoryLimit = memoryLimit * MegaByte;
+        }
+
+        if (memoryBudget > 0 and memoryLimit == 0) {
+            std::cout << "c -mem-budget is ignored without -mem-limit" << std::endl;
+        }
+
+        if (memoryBudget > 0) {
+            options.memoryBudget = memoryBudget * MegaByte;
+        }
+
+        std::vector<std::string> files;
+        try {
+            files = collectInstances(file);
+        } catch (const std::exception &e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+
+        std::cout << "c solving " << files.size() << " instances, " << maxInFlight(options) << " at a time"
+                  << std::endl;
+        StopWatch watch;
+        const auto results = solveBatch(files, options, [](const InstanceResult &result) {
+            std::cout << result.status << " " << result.time.count() << "ms " << result.file << std::endl;
+        });
+
+        const auto numSolved = std::ranges::count_if(results, [](const InstanceResult &result) {
+            return result.status == InstanceStatus::Sat || result.status == InstanceStatus::Unsat;
+        });
+
+        std::cout << "c solved " << numSolved << " of " << results.size() << " instances in "
+                  << watch.elapsed<std::chrono::milliseconds>() << "ms" << std::endl;
+        return 0;
+    }
+
+    std::ifstream ifs(file);
+    if (not ifs.is_open()) {
+        std::cerr << "Could not open file " << file << std::endl;
+        return 1;
+    }
+
+    StopWatch watch;
+    auto [clauses, numVariables] = inout::read_from_dimacs(ifs);
+    std::cout << "c parsed " << clauses.size() << " clauses over " << numVariables << " variables in "
+              << watch.elapsed<std::chrono::milliseconds>() << "ms" << std::endl;
+    Preprocessor preprocessor(static_cast<unsigned>(numVariables), blockingSteps);
+    if (not noPreprocessing) {
+        watch.start();
+        for (auto &clause : clauses) {
+            if (not preprocessor.addClause(std::move(clause))) {
+                break;
+            }
+        }
+
+        preprocessor.eliminate();
+        clauses = preprocessor.getClauses();
+        const auto &preStats = preprocessor.getStatistics();
+        std::cout << "c preprocessed in " << watch.elapsed<std::chrono::milliseconds>() << "ms: "
+                  << preStats.eliminatedVariables << " eliminated variables, " << preStats.fixedVariables
+                  << " fixed variables, " << preStats.subsumedClauses << " subsumed and "
+                  << preStats.strengthenedClauses << " strengthened clauses, " << preStats.blockedClauses
+                  << " blocked clauses, " << clauses.size() << " remaining clauses" << std::endl;
+    }
+
+    watch.start();
+    const auto configs = makePortfolio(std::max(numThreads, 1u), base);
+    SolveResult result;
+    std::vector<TruthValue> model;
+    if (cubeDepth > 0) {
+        auto outcome = solveCubes(clauses, static_cast<unsigned>(numVariables), configs, cubeDepth);
+        std::cout << "c solved in " << watch.elapsed<std::chrono::milliseconds>() << "ms" << std::endl;
+        std::cout << "c cubes: " << outcome.cubes << ", solved cubes: " << outcome.solvedCubes << ", pruned cubes: "
+                  << outcome.prunedCubes << std::endl;
+        result = outcome.result;
+        model = std::move(outcome.model);
+    } else {
+        // all workers share the clauses, a single thread runs the base configuration
+        auto [portfolioResult, portfolioModel, stats, winner] = solvePortfolio(
+            clauses, static_cast<unsigned>(numVariables), configs);
+        result = portfolioResult;
+        model = std::move(portfolioModel);
+        std::cout << "c solved in " << watch.elapsed<std::chrono::milliseconds>() << "ms";
+        if (numThreads > 1) {
+            std::cout << " by worker " << winner << " of " << numThreads;
+        }
+
+        std::cout << std::endl;
+        std::cout << "c decisions: " << stats.decisions << ", conflicts: " << stats.conflicts << ", propagations: "
+                  << stats.propagations << ", learned clauses: " << stats.learnedClauses << ", minimized literals: "
+                  << stats.minimizedLiterals << std::endl;
+        std::cout << "c reductions: " << stats.reductions << ", deleted clauses: " << stats.deletedClauses
+                  << ", arena compactions: " << stats.compactions
+                  << ", restarts: " << stats.restarts << ", chronological backtracks: " << stats.chronoBacktracks
+                  << std::endl;
+        std::cout << "c subsumed learned clauses: " << stats.subsumedClauses << ", strengthened learned clauses: "
+                  << stats.strengthenedClauses << ", failed literals: " << stats.failedLiterals
+                  << ", substituted variables: " << stats.substitutedVariables << ", vivified clauses: "
+                  << stats.vivifiedClauses << " (" << stats.vivifiedLiterals << " literals removed)" << std::endl;
+        if (numThreads > 1) {
+            std::cout << "c exported clauses: " << stats.exportedClauses << ", imported clauses: "
+                      << stats.importedClauses << ", useful imported clauses: " << stats.usefulImports << std::endl;
+        }
+    }
+
+    if (result == SolveResult::Unsat) {
+        std::cout << "s UNSATISFIABLE" << std::endl;
+        return 20;
+    }
+
+    if (result == SolveResult::Unknown) {
+        std::cout << "s UNKNOWN" << std::endl;
+        return 0;
+    }
+
+    preprocessor.extend(model);
+    std::cout << "s SATISFIABLE" << std::endl << "v";
+    for (unsigned varId = 0; varId < numVariables; ++varId) {
+        const Literal l = model[varId] == TruthValue::True ? pos(varId) : neg(varId);
+        std::cout << " " << inout::to_dimacs(l);
+    }
+
+    std::cout << " 0" << std::endl;
+    return 10;
+}